@@ -0,0 +1,121 @@
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/huge_page_memory_resource.hpp"
+#include "../lib/storage/table.hpp"
+
+// Compares TableScan on a table allocated with regular pages against the same table backed by huge pages. Reports the
+// run time and, where perf events are accessible, the data TLB read misses of the scans.
+//
+//   hyriseHugePageBenchmark [row count] [repetitions]
+
+namespace {
+
+// counts the data TLB read misses of this thread while it is enabled
+class DtlbMissCounter {
+ public:
+  DtlbMissCounter() {
+    auto attributes = perf_event_attr{};
+    attributes.size = sizeof(attributes);
+    attributes.type = PERF_TYPE_HW_CACHE;
+    attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    _file_descriptor = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+  }
+
+  ~DtlbMissCounter() {
+    if (_file_descriptor >= 0) close(_file_descriptor);
+  }
+
+  void start() {
+    if (_file_descriptor < 0) return;
+    ioctl(_file_descriptor, PERF_EVENT_IOC_RESET, 0);
+    ioctl(_file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+
+  // returns the number of misses since start, if the counter is available
+  std::optional<uint64_t> stop() {
+    if (_file_descriptor < 0) return std::nullopt;
+    ioctl(_file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+    auto count = uint64_t{0};
+    if (read(_file_descriptor, &count, sizeof(count)) != sizeof(count)) return std::nullopt;
+    return count;
+  }
+
+ protected:
+  int _file_descriptor = -1;
+};
+
+std::shared_ptr<opossum::Table> create_table(const size_t row_count, std::pmr::memory_resource* memory_resource) {
+  // large chunks, so that a chunk spans many pages
+  auto table = std::make_shared<opossum::Table>(10'000'000, memory_resource);
+  table->add_column("a", "int");
+
+  auto values = std::vector<int32_t>(row_count);
+  auto value = uint32_t{12345};
+  for (auto& column_value : values) {
+    value = value * 1103515245 + 12345;
+    column_value = static_cast<int32_t>(value >> 16) % 1000;
+  }
+  table->append_columns(std::move(values));
+  return table;
+}
+
+void run_benchmark(const std::string& name, const std::shared_ptr<opossum::Table>& table, const size_t repetitions) {
+  auto table_wrapper = std::make_shared<opossum::TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto counter = DtlbMissCounter{};
+  const auto begin = std::chrono::steady_clock::now();
+  counter.start();
+  auto result_row_count = uint64_t{0};
+  for (auto repetition = size_t{0}; repetition < repetitions; ++repetition) {
+    auto scan =
+        std::make_shared<opossum::TableScan>(table_wrapper, opossum::ColumnID{0}, opossum::ScanType::OpLessThan, 10);
+    scan->execute();
+    result_row_count += scan->get_output()->row_count();
+  }
+  const auto misses = counter.stop();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+
+  std::cout << name << ": " << duration.count() << " ms, dTLB read misses: ";
+  if (misses) {
+    std::cout << *misses;
+  } else {
+    std::cout << "n/a (perf events are not accessible)";
+  }
+  std::cout << ", matches: " << result_row_count << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto row_count = argc > 1 ? std::stoul(argv[1]) : size_t{100'000'000};
+  const auto repetitions = argc > 2 ? std::stoul(argv[2]) : size_t{10};
+
+  run_benchmark("regular pages", create_table(row_count, std::pmr::new_delete_resource()), repetitions);
+
+  const auto memory_resource = opossum::huge_page_memory_resource();
+  run_benchmark("huge pages", create_table(row_count, memory_resource), repetitions);
+  std::cout << "huge page allocations: " << memory_resource->huge_page_allocation_count()
+            << ", transparent huge page fallbacks: " << memory_resource->fallback_allocation_count() << std::endl;
+  return 0;
+}
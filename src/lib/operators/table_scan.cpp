@@ -1,11 +1,22 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "resolve_segment_type.hpp"
 #include "resolve_type.hpp"
+#include "storage/base_index.hpp"
+#include "storage/bloom_filter.hpp"
 #include "storage/chunk.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterables.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 #include "table_scan.hpp"
@@ -13,6 +24,31 @@
 
 namespace opossum {
 
+namespace {
+
+// Indexes are only used if at most this share of the rows of a chunk match. For more rows, the positions found by the
+// index are scattered too widely (and have to be sorted), so that scanning the segment is faster.
+constexpr auto MAX_INDEX_SELECTIVITY = 0.1;
+
+// returns the first index in [0, size) for which the predicate is false, given that it is true for all indices before
+// and false for all indices after it
+template <typename Predicate>
+ChunkOffset find_partition_point(const ChunkOffset size, const Predicate& predicate) {
+  auto begin = ChunkOffset{0};
+  auto end = size;
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    if (predicate(middle)) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+}  // namespace
+
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
                      const AllTypeVariant search_value)
     : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
@@ -54,51 +90,85 @@ const std::shared_ptr<const Table> TableScan::TableScanImpl<T>::execute() const
   // It allows us to detect when we need to add another ReferenceSegment, because the referenced table changed.
   std::shared_ptr<const Table> last_referenced_table = nullptr;
 
+  // Segments with a Bloom filter are skipped in equality scans if the filter rules out the search value.
+  const auto search_value_hash = bloom_filter_hash(_search_value);
+
   // Here, we iterate through all chunks of the input table. Within the loop, we only retrieve one segment per chunk,
   // more specifically, the segment corresponding to the column we want to filter on.
+  auto prefetch_chunk_index = ChunkID{0};
   for (auto chunk_index = ChunkID(0); chunk_index < _table->chunk_count(); ++chunk_index) {
     const auto& chunk = _table->get_chunk(chunk_index);
-    const auto& segment_to_scan = chunk.get_segment(_column_id);
-
-    // The following three blocks work similarly. They first check the type of the segment_to_scan. Then, they add
-    // a new chunk including ReferenceSegments to the result table if the last referenced table is different from the
-    // current table and at least one valid row has been found.
-    // There is a slight difference between ValueSegments/DictionarySegments and ReferenceSegments: The former compare
-    // the _table with the last_referenced_table, whereas the latter needs to compare the table referenced by the
-    // ReferenceSegment with the last_referenced_table.
-
-    const auto& value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment_to_scan);
-    if (value_segment != nullptr) {
-      if (last_referenced_table != nullptr && last_referenced_table != _table && !result_pos_list->empty()) {
-        _add_chunk(result_table, result_pos_list, last_referenced_table);
+
+    // If the zone map shows that no value of the chunk can match, the chunk is skipped. If all values match, all rows
+    // are added without looking at the values. ReferenceSegments do not have zone maps. Both checks (and the Bloom
+    // filter check below) do not need the segment, so skipped chunks are not loaded if they have been evicted.
+    const auto zone_map = chunk.zone_map(_column_id);
+    if (zone_map) {
+      const auto zone_map_match = _match_zone_map(*zone_map);
+      if (zone_map_match == ZoneMapMatch::None) continue;
+      if (zone_map_match == ZoneMapMatch::All) {
+        if (last_referenced_table != nullptr && last_referenced_table != _table && !result_pos_list->empty()) {
+          _add_chunk(result_table, result_pos_list, last_referenced_table);
+        }
+        last_referenced_table = _table;
+        _add_rows(chunk_index, result_pos_list, ChunkOffset{0}, static_cast<ChunkOffset>(chunk.size()));
+        continue;
       }
-      last_referenced_table = _table;
-      _scan_segment(chunk_index, result_pos_list, value_segment);
-      continue;
     }
 
-    const auto& dict_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment_to_scan);
-    if (dict_segment != nullptr) {
-      if (last_referenced_table != nullptr && last_referenced_table != _table && !result_pos_list->empty()) {
-        _add_chunk(result_table, result_pos_list, last_referenced_table);
-      }
-      last_referenced_table = _table;
-      _scan_segment(chunk_index, result_pos_list, dict_segment);
-      continue;
+    if (_scan_type == ScanType::OpEquals) {
+      const auto bloom_filter = chunk.bloom_filter(_column_id);
+      if (bloom_filter && !bloom_filter->may_contain(search_value_hash)) continue;
     }
 
-    const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment_to_scan);
-    if (reference_segment != nullptr) {
-      if (last_referenced_table != nullptr && last_referenced_table != reference_segment->referenced_table() &&
-          !result_pos_list->empty()) {
-        _add_chunk(result_table, result_pos_list, last_referenced_table);
+    // If chunks of the table have been evicted, the next chunk that has to be scanned is loaded while this one is
+    // scanned. The chunks in between are skipped, so they are not prefetched.
+    if (_table->buffer_manager()) {
+      prefetch_chunk_index = std::max(prefetch_chunk_index, ChunkID{chunk_index + 1});
+      for (; prefetch_chunk_index < _table->chunk_count(); ++prefetch_chunk_index) {
+        if (_needs_segment(_table->get_chunk(prefetch_chunk_index), search_value_hash)) {
+          _table->prefetch_chunk(prefetch_chunk_index);
+          break;
+        }
       }
-      last_referenced_table = reference_segment->referenced_table();
-      _scan_segment(result_pos_list, reference_segment);
-      continue;
     }
 
-    Fail("Type mismatch: Cannot cast table segments to type of search_value.");
+    const auto segment_to_scan = chunk.get_segment(_column_id);
+    const auto sort_mode = chunk.sorted_by(_column_id);
+    const auto indexes = chunk.get_indexes({_column_id});
+
+    // The type of the segment_to_scan is resolved once per chunk. A new chunk including ReferenceSegments is added to
+    // the result table if the last referenced table is different from the table referenced by the segment_to_scan and
+    // at least one valid row has been found. Encoded segments reference the _table, whereas ReferenceSegments reference
+    // another table.
+    resolve_segment_type<T>(*segment_to_scan, [&](const auto& typed_segment) {
+      using SegmentClass = std::decay_t<decltype(typed_segment)>;
+
+      auto referenced_table = _table;
+      if constexpr (std::is_same<SegmentClass, ReferenceSegment>::value) {
+        referenced_table = typed_segment.referenced_table();
+      }
+      if (last_referenced_table != nullptr && last_referenced_table != referenced_table && !result_pos_list->empty()) {
+        _add_chunk(result_table, result_pos_list, last_referenced_table);
+      }
+      last_referenced_table = referenced_table;
+
+      if constexpr (std::is_same<SegmentClass, ReferenceSegment>::value) {
+        _scan_segment(result_pos_list, typed_segment);
+      } else {
+        // Sorted segments are binary searched. Otherwise, an index on the segment is used for selective scans.
+        if constexpr (std::is_same<SegmentClass, ValueSegment<T>>::value ||
+                      std::is_same<SegmentClass, DictionarySegment<T>>::value) {
+          if (sort_mode) {
+            _scan_sorted_segment(chunk_index, result_pos_list, typed_segment, *sort_mode);
+            return;
+          }
+        }
+        const auto segment_size = static_cast<ChunkOffset>(typed_segment.size());
+        if (!indexes.empty() && _scan_index(chunk_index, result_pos_list, *indexes.front(), segment_size)) return;
+        _scan_segment(chunk_index, result_pos_list, typed_segment);
+      }
+    });
   }
 
   if (!result_pos_list->empty()) {
@@ -137,34 +207,371 @@ void TableScan::TableScanImpl<T>::_add_chunk(const std::shared_ptr<Table>& resul
 
 template <typename T>
 void TableScan::TableScanImpl<T>::_scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
-                                                const std::shared_ptr<ValueSegment<T>> segment) const {
-  const auto& values = segment->values();
-  for (auto i = ChunkOffset(0); i < values.size(); ++i) {
-    if (_matches_search_value(values[i])) {
+                                                const ValueSegment<T>& segment) const {
+  ValueSegmentIterable<T>{segment}.for_each([&](const auto& position) {
+    if (_matches_search_value(position.value)) {
       auto row_id = RowID();
-      row_id.chunk_offset = i;
+      row_id.chunk_offset = position.chunk_offset;
       row_id.chunk_id = current_chunk_id;
       pos_list->emplace_back(std::move(row_id));
     }
+  });
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::_scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                                                const DictionarySegment<T>& segment) const {
+  const auto& attribute_vector = segment.attribute_vector();
+
+  ValueID lower_bound = segment.lower_bound(_search_value);
+  ValueID upper_bound = segment.upper_bound(_search_value);
+
+  // The value ids are decoded block by block, which avoids a virtual call per row and lets compressed attribute
+  // vectors unpack many value ids at once.
+  auto value_ids = ValueIDBlock{};
+  for (size_t block_offset = 0; block_offset < segment.size();) {
+    const auto decoded_count = attribute_vector->decode_block(block_offset, value_ids);
+    for (size_t index = 0; index < decoded_count; ++index) {
+      if (_matches_value_id(value_ids[index], lower_bound, upper_bound)) {
+        auto row_id = RowID();
+        row_id.chunk_offset = ChunkOffset(block_offset + index);
+        row_id.chunk_id = current_chunk_id;
+        pos_list->emplace_back(std::move(row_id));
+      }
+    }
+    block_offset += decoded_count;
+  }
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::_scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                                                const RunLengthSegment<T>& segment) const {
+  const auto& values = *segment.values();
+  const auto& end_positions = *segment.end_positions();
+
+  // The predicate is evaluated only once per run. If it matches, all positions of the run are added.
+  auto run_start = ChunkOffset{0};
+  for (size_t run_index = 0; run_index < values.size(); ++run_index) {
+    const auto run_end = end_positions[run_index];
+    if (_matches_search_value(values[run_index])) {
+      for (auto chunk_offset = run_start; chunk_offset <= run_end; ++chunk_offset) {
+        auto row_id = RowID();
+        row_id.chunk_offset = chunk_offset;
+        row_id.chunk_id = current_chunk_id;
+        pos_list->emplace_back(std::move(row_id));
+      }
+    }
+    run_start = run_end + 1;
+  }
+}
+
+template <typename T>
+template <typename U>
+void TableScan::TableScanImpl<T>::_scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                                                const FrameOfReferenceSegment<U>& segment) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto& block_minima = *segment.block_minima();
+  const auto& offsets = segment.offsets();
+
+  auto decoded_offsets = ValueIDBlock{};
+  for (size_t block_index = 0; block_index < block_minima.size(); ++block_index) {
+    // The search value is rewritten into the offset space of the block, so that the offsets can be compared without
+    // decoding the values. Like the value ids of a DictionarySegment, lower_bound is the first offset >= the search
+    // value and upper_bound the first offset > the search value.
+    const auto block_minimum = block_minima[block_index];
+    auto lower_bound = ValueID{0};
+    auto upper_bound = ValueID{0};
+    if (_search_value >= block_minimum) {
+      const auto search_offset = static_cast<UnsignedT>(_search_value) - static_cast<UnsignedT>(block_minimum);
+      if (search_offset > segment.max_offset()) {
+        // all values of the block are smaller than the search value
+        lower_bound = INVALID_VALUE_ID;
+        upper_bound = INVALID_VALUE_ID;
+      } else {
+        lower_bound = ValueID{static_cast<uint32_t>(search_offset)};
+        upper_bound = ValueID{static_cast<uint32_t>(search_offset + 1)};
+      }
+    }
+
+    const auto block_begin = block_index * FrameOfReferenceSegment<T>::BLOCK_SIZE;
+    const auto block_end = std::min(segment.size(), block_begin + FrameOfReferenceSegment<T>::BLOCK_SIZE);
+    for (auto decode_offset = block_begin; decode_offset < block_end;) {
+      const auto decoded_count = offsets->decode_block(decode_offset, decoded_offsets);
+      for (size_t index = 0; index < decoded_count; ++index) {
+        if (_matches_value_id(decoded_offsets[index], lower_bound, upper_bound)) {
+          auto row_id = RowID();
+          row_id.chunk_offset = ChunkOffset(decode_offset + index);
+          row_id.chunk_id = current_chunk_id;
+          pos_list->emplace_back(std::move(row_id));
+        }
+      }
+      decode_offset += decoded_count;
+    }
+  }
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::_add_rows(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                                            const ChunkOffset begin, const ChunkOffset end) const {
+  pos_list->reserve(pos_list->size() + (end - begin));
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    auto row_id = RowID();
+    row_id.chunk_offset = chunk_offset;
+    row_id.chunk_id = current_chunk_id;
+    pos_list->emplace_back(std::move(row_id));
+  }
+}
+
+template <typename T>
+bool TableScan::TableScanImpl<T>::_needs_segment(const Chunk& chunk, const size_t search_value_hash) const {
+  const auto zone_map = chunk.zone_map(_column_id);
+  if (zone_map && _match_zone_map(*zone_map) != ZoneMapMatch::Some) return false;
+  if (_scan_type == ScanType::OpEquals) {
+    const auto bloom_filter = chunk.bloom_filter(_column_id);
+    if (bloom_filter && !bloom_filter->may_contain(search_value_hash)) return false;
+  }
+  return true;
+}
+
+template <typename T>
+typename TableScan::TableScanImpl<T>::ZoneMapMatch TableScan::TableScanImpl<T>::_match_zone_map(
+    const ZoneMap& zone_map) const {
+  const auto min = type_cast<T>(zone_map.min);
+  const auto max = type_cast<T>(zone_map.max);
+
+  auto matches_none = false;
+  auto matches_all = false;
+  switch (_scan_type) {
+    case ScanType::OpEquals: {
+      matches_none = _search_value < min || _search_value > max;
+      matches_all = min == _search_value && max == _search_value;
+      break;
+    }
+    case ScanType::OpNotEquals: {
+      matches_none = min == _search_value && max == _search_value;
+      matches_all = _search_value < min || _search_value > max;
+      break;
+    }
+    case ScanType::OpGreaterThan: {
+      matches_none = max <= _search_value;
+      matches_all = min > _search_value;
+      break;
+    }
+    case ScanType::OpGreaterThanEquals: {
+      matches_none = max < _search_value;
+      matches_all = min >= _search_value;
+      break;
+    }
+    case ScanType::OpLessThan: {
+      matches_none = min >= _search_value;
+      matches_all = max < _search_value;
+      break;
+    }
+    case ScanType::OpLessThanEquals: {
+      matches_none = min > _search_value;
+      matches_all = max <= _search_value;
+      break;
+    }
+    default: { Fail("Unknown scan type operator"); }
   }
+
+  if (matches_none) return ZoneMapMatch::None;
+  if (matches_all) return ZoneMapMatch::All;
+  return ZoneMapMatch::Some;
 }
 
 template <typename T>
+template <typename U>
 void TableScan::TableScanImpl<T>::_scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
-                                                const std::shared_ptr<DictionarySegment<T>> segment) const {
-  const auto& attribute_vector = segment->attribute_vector();
+                                                const DeltaSegment<U>& segment) const {
+  const auto segment_size = static_cast<ChunkOffset>(segment.size());
+
+  if (segment.is_sorted()) {
+    // the bounds of the matching rows are found by binary search
+    _add_sorted_rows(current_chunk_id, pos_list, segment.lower_bound(_search_value),
+                     segment.upper_bound(_search_value), segment_size, SortMode::Ascending);
+    return;
+  }
+
+  auto values = typename DeltaSegment<T>::ValueBlock{};
+  for (size_t block_index = 0; block_index < segment.checkpoints()->size(); ++block_index) {
+    const auto block_begin = block_index * DeltaSegment<T>::CHECKPOINT_INTERVAL;
+    const auto value_count = segment.decode_block(block_index, values);
+    for (size_t index = 0; index < value_count; ++index) {
+      if (_matches_search_value(values[index])) {
+        auto row_id = RowID();
+        row_id.chunk_offset = ChunkOffset(block_begin + index);
+        row_id.chunk_id = current_chunk_id;
+        pos_list->emplace_back(std::move(row_id));
+      }
+    }
+  }
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::_scan_sorted_segment(const ChunkID current_chunk_id,
+                                                       std::shared_ptr<PosList> pos_list,
+                                                       const ValueSegment<T>& segment,
+                                                       const SortMode sort_mode) const {
+  const auto& values = segment.values();
+  auto equal_begin = values.begin();
+  auto equal_end = values.begin();
+  if (sort_mode == SortMode::Ascending) {
+    equal_begin = std::lower_bound(values.begin(), values.end(), _search_value);
+    equal_end = std::upper_bound(equal_begin, values.end(), _search_value);
+  } else {
+    equal_begin = std::lower_bound(values.begin(), values.end(), _search_value, std::greater<>{});
+    equal_end = std::upper_bound(equal_begin, values.end(), _search_value, std::greater<>{});
+  }
+
+  _add_sorted_rows(current_chunk_id, pos_list, static_cast<ChunkOffset>(std::distance(values.begin(), equal_begin)),
+                   static_cast<ChunkOffset>(std::distance(values.begin(), equal_end)),
+                   static_cast<ChunkOffset>(values.size()), sort_mode);
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::_scan_sorted_segment(const ChunkID current_chunk_id,
+                                                       std::shared_ptr<PosList> pos_list,
+                                                       const DictionarySegment<T>& segment,
+                                                       const SortMode sort_mode) const {
+  // The dictionary is sorted, so the value ids are in the same order as the values. The search value is turned into
+  // value ids once, and the attribute vector is binary searched without decoding the values.
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto lower_bound = segment.lower_bound(_search_value);
+  const auto upper_bound = segment.upper_bound(_search_value);
+  const auto segment_size = static_cast<ChunkOffset>(segment.size());
+
+  auto equal_begin = ChunkOffset{0};
+  auto equal_end = ChunkOffset{0};
+  if (sort_mode == SortMode::Ascending) {
+    equal_begin = find_partition_point(segment_size, [&](const auto index) {
+      return attribute_vector.get(index) < lower_bound;
+    });
+    equal_end = find_partition_point(segment_size, [&](const auto index) {
+      return attribute_vector.get(index) < upper_bound;
+    });
+  } else {
+    equal_begin = find_partition_point(segment_size, [&](const auto index) {
+      return attribute_vector.get(index) >= upper_bound;
+    });
+    equal_end = find_partition_point(segment_size, [&](const auto index) {
+      return attribute_vector.get(index) >= lower_bound;
+    });
+  }
 
-  ValueID lower_bound = segment->lower_bound(_search_value);
-  ValueID upper_bound = segment->upper_bound(_search_value);
+  _add_sorted_rows(current_chunk_id, pos_list, equal_begin, equal_end, segment_size, sort_mode);
+}
 
-  for (size_t i = 0; i < segment->size(); ++i) {
-    if (_matches_value_id(attribute_vector->get(i), lower_bound, upper_bound)) {
+template <typename T>
+bool TableScan::TableScanImpl<T>::_scan_index(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                                              const BaseIndex& index, const ChunkOffset segment_size) const {
+  // the index holds the positions ordered by value, so the matching rows form at most two ranges of its positions
+  const auto search_values = std::vector<AllTypeVariant>{AllTypeVariant{_search_value}};
+  const auto lower_bound = index.lower_bound(search_values);
+  const auto upper_bound = index.upper_bound(search_values);
+  auto ranges = std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>>();
+  switch (_scan_type) {
+    case ScanType::OpEquals: {
+      ranges = {{lower_bound, upper_bound}};
+      break;
+    }
+    case ScanType::OpNotEquals: {
+      ranges = {{index.cbegin(), lower_bound}, {upper_bound, index.cend()}};
+      break;
+    }
+    case ScanType::OpGreaterThan: {
+      ranges = {{upper_bound, index.cend()}};
+      break;
+    }
+    case ScanType::OpGreaterThanEquals: {
+      ranges = {{lower_bound, index.cend()}};
+      break;
+    }
+    case ScanType::OpLessThan: {
+      ranges = {{index.cbegin(), lower_bound}};
+      break;
+    }
+    case ScanType::OpLessThanEquals: {
+      ranges = {{index.cbegin(), upper_bound}};
+      break;
+    }
+    default: { Fail("Unknown scan type operator"); }
+  }
+
+  auto match_count = size_t{0};
+  for (const auto& range : ranges) match_count += std::distance(range.first, range.second);
+  if (match_count > segment_size * MAX_INDEX_SELECTIVITY) return false;
+
+  // Positions of equal values are in ascending order. Those of multiple values are sorted, so that the rows are in the
+  // same order as after a scan of the segment.
+  const auto first_position = pos_list->size();
+  pos_list->reserve(first_position + match_count);
+  for (const auto& range : ranges) {
+    for (auto position_it = range.first; position_it != range.second; ++position_it) {
       auto row_id = RowID();
-      row_id.chunk_offset = ChunkOffset(i);
+      row_id.chunk_offset = *position_it;
       row_id.chunk_id = current_chunk_id;
       pos_list->emplace_back(std::move(row_id));
     }
   }
+  if (_scan_type != ScanType::OpEquals) {
+    std::sort(pos_list->begin() + first_position, pos_list->end(),
+              [](const auto& left, const auto& right) { return left.chunk_offset < right.chunk_offset; });
+  }
+  return true;
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::_add_sorted_rows(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                                                   const ChunkOffset equal_begin, const ChunkOffset equal_end,
+                                                   const ChunkOffset segment_size, const SortMode sort_mode) const {
+  // the rows before the equal ones are the smaller ones in ascending order, and the greater ones in descending order
+  const auto ascending = sort_mode == SortMode::Ascending;
+  switch (_scan_type) {
+    case ScanType::OpEquals: {
+      _add_rows(current_chunk_id, pos_list, equal_begin, equal_end);
+      break;
+    }
+    case ScanType::OpNotEquals: {
+      _add_rows(current_chunk_id, pos_list, ChunkOffset{0}, equal_begin);
+      _add_rows(current_chunk_id, pos_list, equal_end, segment_size);
+      break;
+    }
+    case ScanType::OpGreaterThan: {
+      if (ascending) {
+        _add_rows(current_chunk_id, pos_list, equal_end, segment_size);
+      } else {
+        _add_rows(current_chunk_id, pos_list, ChunkOffset{0}, equal_begin);
+      }
+      break;
+    }
+    case ScanType::OpGreaterThanEquals: {
+      if (ascending) {
+        _add_rows(current_chunk_id, pos_list, equal_begin, segment_size);
+      } else {
+        _add_rows(current_chunk_id, pos_list, ChunkOffset{0}, equal_end);
+      }
+      break;
+    }
+    case ScanType::OpLessThan: {
+      if (ascending) {
+        _add_rows(current_chunk_id, pos_list, ChunkOffset{0}, equal_begin);
+      } else {
+        _add_rows(current_chunk_id, pos_list, equal_end, segment_size);
+      }
+      break;
+    }
+    case ScanType::OpLessThanEquals: {
+      if (ascending) {
+        _add_rows(current_chunk_id, pos_list, ChunkOffset{0}, equal_end);
+      } else {
+        _add_rows(current_chunk_id, pos_list, equal_begin, segment_size);
+      }
+      break;
+    }
+    default: { Fail("Unknown scan type operator"); }
+  }
 }
 
 template <typename T>
@@ -196,42 +603,17 @@ bool TableScan::TableScanImpl<T>::_matches_value_id(const ValueID& valueID, cons
 
 template <typename T>
 void TableScan::TableScanImpl<T>::_scan_segment(std::shared_ptr<PosList> pos_list,
-                                                const std::shared_ptr<ReferenceSegment> segment) const {
-  const auto& ref_table = segment->referenced_table();
-  const auto& ref_pos_list = segment->pos_list();
-
-  for (const auto& pos : *ref_pos_list) {
-    const auto chunk_id = pos.chunk_id;
-    const auto chunk_offset = pos.chunk_offset;
-
-    const auto& referenced_chunk = ref_table->get_chunk(chunk_id);
-    const auto& referenced_segment = referenced_chunk.get_segment(segment->referenced_column_id());
-
-    bool match = false;
-
-    const auto& value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(referenced_segment);
-    const auto& dict_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(referenced_segment);
-    if (value_segment != nullptr) {
-      const auto& value = value_segment->values()[chunk_offset];
-      match = _matches_search_value(value);
-    } else if (dict_segment != nullptr) {
-      const auto& value = dict_segment->get(chunk_offset);
-      match = _matches_search_value(value);
-    } else {
-      Fail("ReferenceSegment did not point to either a ValueSegment or a DictionarySegment.");
-    }
-
-    if (match) {
-      auto row_id = RowID();
-      row_id.chunk_offset = chunk_offset;
-      row_id.chunk_id = chunk_id;
-      pos_list->emplace_back(std::move(row_id));
-    }
-  }
+                                                const ReferenceSegment& segment) const {
+  // The iterable resolves the type of the referenced segment once per run of positions in the same chunk, not per row.
+  const auto& ref_pos_list = *segment.pos_list();
+  ReferenceSegmentIterable<T>{segment}.for_each([&](const auto& position) {
+    if (_matches_search_value(position.value)) pos_list->emplace_back(ref_pos_list[position.chunk_offset]);
+  });
 }
 
 template <typename T>
-bool TableScan::TableScanImpl<T>::_matches_search_value(const T& value) const {
+template <typename V>
+bool TableScan::TableScanImpl<T>::_matches_search_value(const V& value) const {
   switch (_scan_type) {
     case ScanType::OpEquals: {
       return value == _search_value;
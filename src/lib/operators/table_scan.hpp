@@ -8,14 +8,19 @@
 
 #include "abstract_operator.hpp"
 #include "all_type_variant.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class BaseIndex;
+class Chunk;
 class Table;
 
 class TableScan : public AbstractOperator {
@@ -48,6 +53,9 @@ class TableScan : public AbstractOperator {
     const std::shared_ptr<const Table> execute() const override;
 
    protected:
+    // tells for the value range of a zone map whether none, some, or all of its values match the scan
+    enum class ZoneMapMatch { None, Some, All };
+
     const std::shared_ptr<const Table> _table;
     const ColumnID _column_id;
     const ScanType _scan_type;
@@ -57,12 +65,50 @@ class TableScan : public AbstractOperator {
                     const std::shared_ptr<const Table>& referenced_table) const;
 
     void _scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
-                       const std::shared_ptr<ValueSegment<T>> segment) const;
+                       const ValueSegment<T>& segment) const;
     void _scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
-                       std::shared_ptr<DictionarySegment<T>> segment) const;
-    void _scan_segment(std::shared_ptr<PosList> pos_list, const std::shared_ptr<ReferenceSegment> segment) const;
-
-    bool _matches_search_value(const T& value) const;
+                       const DictionarySegment<T>& segment) const;
+    void _scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                       const RunLengthSegment<T>& segment) const;
+    // FrameOfReferenceSegments and DeltaSegments only exist for integral types. These overloads are templates (U is
+    // always T), so that overload resolution does not instantiate the segment classes for other types.
+    template <typename U>
+    void _scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                       const FrameOfReferenceSegment<U>& segment) const;
+    template <typename U>
+    void _scan_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                       const DeltaSegment<U>& segment) const;
+    void _scan_segment(std::shared_ptr<PosList> pos_list, const ReferenceSegment& segment) const;
+
+    // Segments that are marked as sorted (see Chunk::sorted_by) are scanned by binary search
+    void _scan_sorted_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                              const ValueSegment<T>& segment, const SortMode sort_mode) const;
+    void _scan_sorted_segment(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                              const DictionarySegment<T>& segment, const SortMode sort_mode) const;
+
+    // Adds the rows found by the index and returns true, unless too many rows match for the index to be faster than a
+    // scan of the segment
+    bool _scan_index(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list, const BaseIndex& index,
+                     const ChunkOffset segment_size) const;
+
+    // In a sorted segment, the values equal to the search value are at [equal_begin, equal_end), and the matching rows
+    // form at most two ranges around them. This adds those ranges.
+    void _add_sorted_rows(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list,
+                          const ChunkOffset equal_begin, const ChunkOffset equal_end, const ChunkOffset segment_size,
+                          const SortMode sort_mode) const;
+
+    void _add_rows(const ChunkID current_chunk_id, std::shared_ptr<PosList> pos_list, const ChunkOffset begin,
+                   const ChunkOffset end) const;
+
+    ZoneMapMatch _match_zone_map(const ZoneMap& zone_map) const;
+
+    // returns whether the segment of the chunk has to be scanned, i.e., neither its zone map nor its Bloom filter
+    // decide the scan on their own
+    bool _needs_segment(const Chunk& chunk, size_t search_value_hash) const;
+
+    // V is T or, for strings, std::string_view
+    template <typename V>
+    bool _matches_search_value(const V& value) const;
 
     bool _matches_value_id(const ValueID& valueID, const ValueID& lower_bound, const ValueID& upper_bound) const;
   };
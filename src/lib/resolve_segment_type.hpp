@@ -0,0 +1,116 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace detail {
+
+// The segment type tag says which class template the segment is, the data type has to be right as well. Checking it
+// costs one dynamic_cast per segment.
+template <typename Segment>
+const Segment& cast_segment(const BaseSegment& segment) {
+  Assert(dynamic_cast<const Segment*>(&segment), "Segment does not hold values of the requested type.");
+  return static_cast<const Segment&>(segment);
+}
+
+}  // namespace detail
+
+/**
+ * Resolves the concrete class of a segment by passing it on to a generic lambda. The class is found by
+ * BaseSegment::segment_type, so this costs one virtual call per segment instead of a chain of dynamic_casts. Call it
+ * once per segment, outside of loops over its rows. The lambda is instantiated for every segment type, so adding an
+ * encoding only means adding a case here.
+ *
+ * @param T is the data type of the segment (ReferenceSegments are passed on as they are)
+ * @param segment is a segment that holds values of type T
+ * @param func is a generic lambda or similar accepting a const reference to any segment type
+ *
+ *
+ * Example:
+ *
+ *   resolve_segment_type<T>(*segment, [&](const auto& typed_segment) {
+ *     using SegmentClass = std::decay_t<decltype(typed_segment)>;
+ *     if constexpr (std::is_same<SegmentClass, ValueSegment<T>>::value) {
+ *       process_values(typed_segment.values());
+ *     } else {
+ *       ...
+ *     }
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  switch (segment.segment_type()) {
+    case SegmentType::Value: {
+      func(detail::cast_segment<ValueSegment<T>>(segment));
+      return;
+    }
+    case SegmentType::Dictionary: {
+      func(detail::cast_segment<DictionarySegment<T>>(segment));
+      return;
+    }
+    case SegmentType::RunLength: {
+      func(detail::cast_segment<RunLengthSegment<T>>(segment));
+      return;
+    }
+    case SegmentType::FrameOfReference: {
+      // FrameOfReferenceSegments and DeltaSegments only exist for integral types
+      if constexpr (std::is_integral<T>::value) {
+        func(detail::cast_segment<FrameOfReferenceSegment<T>>(segment));
+      } else {
+        Fail("FrameOfReferenceSegments only hold integral values.");
+      }
+      return;
+    }
+    case SegmentType::Delta: {
+      if constexpr (std::is_integral<T>::value) {
+        func(detail::cast_segment<DeltaSegment<T>>(segment));
+      } else {
+        Fail("DeltaSegments only hold integral values.");
+      }
+      return;
+    }
+    case SegmentType::Reference: {
+      func(static_cast<const ReferenceSegment&>(segment));
+      return;
+    }
+  }
+  Fail("Unknown segment type");
+}
+
+/**
+ * Resolves the data type and the concrete class of a segment by passing both on to a generic lambda
+ *
+ * @param type_string is a string representation of the data type of the segment
+ * @param segment is a segment that holds values of the given type
+ * @param func is a generic lambda or similar accepting a hana::type object and a const reference to a segment type
+ *
+ *
+ * Example:
+ *
+ *   resolve_data_and_segment_type(table->column_type(column_id), *segment, [&](auto type, const auto& typed_segment) {
+ *     using Type = typename decltype(type)::type;
+ *     ...
+ *   });
+ */
+template <typename Functor>
+void resolve_data_and_segment_type(const std::string& type_string, const BaseSegment& segment, const Functor& func) {
+  resolve_data_type(type_string, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    resolve_segment_type<Type>(segment, [&](const auto& typed_segment) { func(type, typed_segment); });
+  });
+}
+
+}  // namespace opossum
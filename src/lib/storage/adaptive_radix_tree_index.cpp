@@ -0,0 +1,191 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <boost/hana/for_each.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_attribute_vector.hpp"
+#include "dictionary_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename U>
+void append_big_endian(const U bits, AdaptiveRadixTreeKey& key) {
+  for (auto byte_index = sizeof(U); byte_index > 0; --byte_index) {
+    key.push_back(static_cast<uint8_t>(bits >> ((byte_index - 1) * 8)));
+  }
+}
+
+// appends the key bytes of a value, see AdaptiveRadixTreeIndex for the format
+template <typename T>
+void append_key(const T& value, AdaptiveRadixTreeKey& key) {
+  if constexpr (std::is_integral<T>::value) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    append_big_endian(static_cast<UnsignedT>(static_cast<UnsignedT>(value) ^ (UnsignedT{1} << (sizeof(T) * 8 - 1))),
+                      key);
+  } else if constexpr (std::is_floating_point<T>::value) {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    // -0.0 and 0.0 are equal, so they need the same key
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = Bits{0};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+    const auto sign_bit = Bits{1} << (sizeof(T) * 8 - 1);
+    append_big_endian(static_cast<Bits>((bits & sign_bit) ? ~bits : bits ^ sign_bit), key);
+  } else {
+    for (const auto character : value) {
+      key.push_back(static_cast<uint8_t>(character));
+      if (character == '\0') key.push_back(255);
+    }
+    key.push_back(0);
+    key.push_back(0);
+  }
+}
+
+AdaptiveRadixTreeKey value_id_key(const ValueID value_id) {
+  auto key = AdaptiveRadixTreeKey();
+  append_big_endian(static_cast<ValueID::base_type>(value_id), key);
+  return key;
+}
+
+}  // namespace
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(
+    const std::vector<std::shared_ptr<const BaseSegment>>& indexed_segments)
+    : BaseIndex(SegmentIndexType::AdaptiveRadixTree) {
+  Assert(indexed_segments.size() == 1, "AdaptiveRadixTreeIndex only works with a single segment");
+  _indexed_segment = indexed_segments.front();
+
+  auto keys = std::vector<std::pair<AdaptiveRadixTreeKey, ChunkOffset>>();
+  keys.reserve(_indexed_segment->size());
+
+  if (_indexed_segment->segment_type() == SegmentType::Dictionary) {
+    _dictionary_segment = std::static_pointer_cast<const BaseDictionarySegment>(_indexed_segment);
+    const auto& attribute_vector = *_dictionary_segment->attribute_vector();
+    auto value_ids = ValueIDBlock{};
+    for (size_t block_offset = 0; block_offset < attribute_vector.size();) {
+      const auto decoded_count = attribute_vector.decode_block(block_offset, value_ids);
+      for (size_t index = 0; index < decoded_count; ++index) {
+        keys.emplace_back(value_id_key(value_ids[index]), ChunkOffset(block_offset + index));
+      }
+      block_offset += decoded_count;
+    }
+    _build(std::move(keys));
+    return;
+  }
+
+  Assert(_indexed_segment->segment_type() == SegmentType::Value,
+         "AdaptiveRadixTreeIndex only works with DictionarySegments and ValueSegments");
+  // the data type is only known to the segment, so each one is tried
+  hana::for_each(types, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(_indexed_segment.get());
+    if (!value_segment) return;
+
+    const auto& values = value_segment->values();
+    for (size_t value_index = 0; value_index < values.size(); ++value_index) {
+      auto key = AdaptiveRadixTreeKey();
+      append_key(values[value_index], key);
+      keys.emplace_back(std::move(key), ChunkOffset(value_index));
+    }
+    _encode_value = [](const AllTypeVariant& value) {
+      auto key = AdaptiveRadixTreeKey();
+      append_key(type_cast<ColumnDataType>(value), key);
+      return key;
+    };
+  });
+  _build(std::move(keys));
+}
+
+size_t AdaptiveRadixTreeIndex::estimate_memory_usage() const {
+  return sizeof(*this) + _positions.capacity() * sizeof(ChunkOffset) + (_root ? _root->estimate_memory_usage() : 0);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (!_root) return _positions.cend();
+  if (_dictionary_segment) {
+    const auto value_id = _dictionary_segment->lower_bound(values.front());
+    if (value_id == INVALID_VALUE_ID) return _positions.cend();
+    return _root->lower_bound(value_id_key(value_id), 0);
+  }
+  return _root->lower_bound(_encode_value(values.front()), 0);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (!_root) return _positions.cend();
+  if (_dictionary_segment) {
+    // the first value id > the value is also the first one >= it
+    const auto value_id = _dictionary_segment->upper_bound(values.front());
+    if (value_id == INVALID_VALUE_ID) return _positions.cend();
+    return _root->lower_bound(value_id_key(value_id), 0);
+  }
+  return _root->upper_bound(_encode_value(values.front()), 0);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _positions.cbegin(); }
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _positions.cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> AdaptiveRadixTreeIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+void AdaptiveRadixTreeIndex::_build(std::vector<std::pair<AdaptiveRadixTreeKey, ChunkOffset>>&& keys) {
+  // sorting the pairs keeps the positions of equal keys in ascending order
+  std::sort(keys.begin(), keys.end());
+
+  _positions.reserve(keys.size());
+  for (const auto& key : keys) _positions.push_back(key.second);
+  if (keys.empty()) return;
+
+  // the distinct keys and the first position of each of them, followed by the end of the positions
+  auto distinct_keys = std::vector<AdaptiveRadixTreeKey>();
+  auto key_begins = std::vector<Iterator>();
+  for (size_t key_index = 0; key_index < keys.size(); ++key_index) {
+    if (!distinct_keys.empty() && keys[key_index].first == distinct_keys.back()) continue;
+    distinct_keys.push_back(std::move(keys[key_index].first));
+    key_begins.push_back(_positions.cbegin() + key_index);
+  }
+  key_begins.push_back(_positions.cend());
+
+  _root = _build_node(distinct_keys, key_begins, 0, distinct_keys.size(), 0);
+}
+
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_build_node(const std::vector<AdaptiveRadixTreeKey>& keys,
+                                                             const std::vector<Iterator>& key_begins,
+                                                             const size_t first, const size_t last,
+                                                             const size_t depth) const {
+  if (last - first == 1) return std::make_unique<ARTLeaf>(keys[first], key_begins[first], key_begins[last]);
+
+  // As the keys are sorted, the bytes that the first and the last key share are shared by all of them. The keys
+  // differ after that, as none is a prefix of another one.
+  const auto& first_key = keys[first];
+  const auto& last_key = keys[last - 1];
+  auto child_depth = depth;
+  while (first_key[child_depth] == last_key[child_depth]) ++child_depth;
+  auto prefix = AdaptiveRadixTreeKey(first_key.cbegin() + depth, first_key.cbegin() + child_depth);
+
+  auto children = ARTChildren();
+  for (auto child_first = first; child_first < last;) {
+    const auto key_byte = keys[child_first][child_depth];
+    auto child_last = child_first + 1;
+    while (child_last < last && keys[child_last][child_depth] == key_byte) ++child_last;
+    children.emplace_back(key_byte, _build_node(keys, key_begins, child_first, child_last, child_depth + 1));
+    child_first = child_last;
+  }
+
+  return make_art_inner_node(std::move(prefix), std::move(children), key_begins[first], key_begins[last]);
+}
+
+}  // namespace opossum
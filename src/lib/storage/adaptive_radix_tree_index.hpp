@@ -0,0 +1,60 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+class BaseSegment;
+
+// An Adaptive Radix Tree on a single segment, for point and range lookups on key columns with many distinct values
+// (e.g., customer ids), where it needs far fewer comparisons than a binary search. See adaptive_radix_tree_nodes.hpp.
+//
+// On a DictionarySegment, the keys are the value ids, and search values are turned into value ids by the dictionary.
+// On a ValueSegment, the keys are the values themselves, encoded as byte strings that compare like the values:
+//
+//   integers: big-endian, with the sign bit flipped
+//   floats:   big-endian, with the sign bit flipped for positive numbers and all bits flipped for negative ones
+//   strings:  the characters, with each 0 byte escaped as 0 255, followed by the terminator 0 0
+//
+// Values must not be appended to the segment after the index has been created.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& indexed_segments);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const override;
+
+  // sorts the keys and builds the positions and the tree from them
+  void _build(std::vector<std::pair<AdaptiveRadixTreeKey, ChunkOffset>>&& keys);
+
+  std::unique_ptr<ARTNode> _build_node(const std::vector<AdaptiveRadixTreeKey>& keys,
+                                       const std::vector<Iterator>& key_begins, const size_t first, const size_t last,
+                                       const size_t depth) const;
+
+  std::shared_ptr<const BaseSegment> _indexed_segment;
+
+  // only set for DictionarySegments
+  std::shared_ptr<const BaseDictionarySegment> _dictionary_segment;
+
+  // only set for ValueSegments, encodes a search value in the key format of the values
+  std::function<AdaptiveRadixTreeKey(const AllTypeVariant&)> _encode_value;
+
+  std::vector<ChunkOffset> _positions;
+  std::unique_ptr<ARTNode> _root;
+};
+
+}  // namespace opossum
@@ -0,0 +1,169 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ARTNode::ARTNode(const Iterator begin, const Iterator end) : _begin(begin), _end(end) {}
+
+ARTNode::Iterator ARTNode::begin() const { return _begin; }
+
+ARTNode::Iterator ARTNode::end() const { return _end; }
+
+ARTLeaf::ARTLeaf(AdaptiveRadixTreeKey key, const Iterator begin, const Iterator end)
+    : ARTNode(begin, end), _key(std::move(key)) {}
+
+ARTNode::Iterator ARTLeaf::lower_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const {
+  // the bytes before depth are equal, as they led to this leaf
+  const auto is_smaller =
+      std::lexicographical_compare(_key.cbegin() + depth, _key.cend(), key.cbegin() + depth, key.cend());
+  return is_smaller ? _end : _begin;
+}
+
+ARTNode::Iterator ARTLeaf::upper_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const {
+  const auto is_greater =
+      std::lexicographical_compare(key.cbegin() + depth, key.cend(), _key.cbegin() + depth, _key.cend());
+  return is_greater ? _begin : _end;
+}
+
+size_t ARTLeaf::estimate_memory_usage() const { return sizeof(*this) + _key.capacity(); }
+
+ARTInnerNode::ARTInnerNode(AdaptiveRadixTreeKey prefix, const Iterator begin, const Iterator end)
+    : ARTNode(begin, end), _prefix(std::move(prefix)) {}
+
+ARTNode::Iterator ARTInnerNode::lower_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const {
+  return _bound<false>(key, depth);
+}
+
+ARTNode::Iterator ARTInnerNode::upper_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const {
+  return _bound<true>(key, depth);
+}
+
+template <bool IsUpperBound>
+ARTNode::Iterator ARTInnerNode::_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const {
+  // If the key differs from the prefix, it is smaller or greater than all keys of the subtree. A key that ends within
+  // the prefix is a prefix of them and thus smaller.
+  for (size_t prefix_index = 0; prefix_index < _prefix.size(); ++prefix_index) {
+    if (depth + prefix_index == key.size() || key[depth + prefix_index] < _prefix[prefix_index]) return _begin;
+    if (key[depth + prefix_index] > _prefix[prefix_index]) return _end;
+  }
+
+  const auto key_byte_index = depth + _prefix.size();
+  if (key_byte_index == key.size()) return _begin;
+
+  const auto key_byte = key[key_byte_index];
+  if (const auto child = _child(key_byte)) {
+    return IsUpperBound ? child->upper_bound(key, key_byte_index + 1) : child->lower_bound(key, key_byte_index + 1);
+  }
+
+  // The positions of the subtrees are contiguous, so the bound is the first position of the next greater child
+  const auto next_child = _next_child(key_byte);
+  return next_child ? next_child->begin() : _end;
+}
+
+template <size_t Capacity>
+ARTSortedNode<Capacity>::ARTSortedNode(AdaptiveRadixTreeKey prefix, ARTChildren&& children, const Iterator begin,
+                                       const Iterator end)
+    : ARTInnerNode(std::move(prefix), begin, end), _child_count(static_cast<uint8_t>(children.size())) {
+  DebugAssert(children.size() <= Capacity, "too many children for the node");
+  for (size_t child_index = 0; child_index < children.size(); ++child_index) {
+    _key_bytes[child_index] = children[child_index].first;
+    _children[child_index] = std::move(children[child_index].second);
+  }
+}
+
+template <size_t Capacity>
+size_t ARTSortedNode<Capacity>::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _prefix.capacity();
+  for (size_t child_index = 0; child_index < _child_count; ++child_index) {
+    memory_usage += _children[child_index]->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+template <size_t Capacity>
+const ARTNode* ARTSortedNode<Capacity>::_child(const uint8_t key_byte) const {
+  const auto key_bytes_end = _key_bytes.cbegin() + _child_count;
+  const auto key_byte_it = std::lower_bound(_key_bytes.cbegin(), key_bytes_end, key_byte);
+  if (key_byte_it == key_bytes_end || *key_byte_it != key_byte) return nullptr;
+  return _children[std::distance(_key_bytes.cbegin(), key_byte_it)].get();
+}
+
+template <size_t Capacity>
+const ARTNode* ARTSortedNode<Capacity>::_next_child(const uint8_t key_byte) const {
+  const auto key_bytes_end = _key_bytes.cbegin() + _child_count;
+  const auto key_byte_it = std::upper_bound(_key_bytes.cbegin(), key_bytes_end, key_byte);
+  if (key_byte_it == key_bytes_end) return nullptr;
+  return _children[std::distance(_key_bytes.cbegin(), key_byte_it)].get();
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(AdaptiveRadixTreeKey prefix, ARTChildren&& children, const Iterator begin, const Iterator end)
+    : ARTInnerNode(std::move(prefix), begin, end) {
+  DebugAssert(children.size() <= _children.size(), "too many children for the node");
+  _child_indices.fill(NO_CHILD);
+  for (size_t child_index = 0; child_index < children.size(); ++child_index) {
+    _child_indices[children[child_index].first] = static_cast<uint8_t>(child_index);
+    _children[child_index] = std::move(children[child_index].second);
+  }
+}
+
+size_t ARTNode48::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _prefix.capacity();
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+const ARTNode* ARTNode48::_child(const uint8_t key_byte) const {
+  const auto child_index = _child_indices[key_byte];
+  return child_index == NO_CHILD ? nullptr : _children[child_index].get();
+}
+
+const ARTNode* ARTNode48::_next_child(const uint8_t key_byte) const {
+  for (auto next_key_byte = size_t{key_byte} + 1; next_key_byte < _child_indices.size(); ++next_key_byte) {
+    if (_child_indices[next_key_byte] != NO_CHILD) return _children[_child_indices[next_key_byte]].get();
+  }
+  return nullptr;
+}
+
+ARTNode256::ARTNode256(AdaptiveRadixTreeKey prefix, ARTChildren&& children, const Iterator begin, const Iterator end)
+    : ARTInnerNode(std::move(prefix), begin, end) {
+  for (auto& [key_byte, child] : children) _children[key_byte] = std::move(child);
+}
+
+size_t ARTNode256::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _prefix.capacity();
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+const ARTNode* ARTNode256::_child(const uint8_t key_byte) const { return _children[key_byte].get(); }
+
+const ARTNode* ARTNode256::_next_child(const uint8_t key_byte) const {
+  for (auto next_key_byte = size_t{key_byte} + 1; next_key_byte < _children.size(); ++next_key_byte) {
+    if (_children[next_key_byte]) return _children[next_key_byte].get();
+  }
+  return nullptr;
+}
+
+std::unique_ptr<ARTNode> make_art_inner_node(AdaptiveRadixTreeKey prefix, ARTChildren&& children,
+                                             const ARTNode::Iterator begin, const ARTNode::Iterator end) {
+  DebugAssert(children.size() >= 2, "inner nodes have at least two children");
+  if (children.size() <= 4) return std::make_unique<ARTNode4>(std::move(prefix), std::move(children), begin, end);
+  if (children.size() <= 16) return std::make_unique<ARTNode16>(std::move(prefix), std::move(children), begin, end);
+  if (children.size() <= 48) return std::make_unique<ARTNode48>(std::move(prefix), std::move(children), begin, end);
+  return std::make_unique<ARTNode256>(std::move(prefix), std::move(children), begin, end);
+}
+
+}  // namespace opossum
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The nodes of an AdaptiveRadixTreeIndex (Leis et al., "The Adaptive Radix Tree: ARTful Indexing for Main-Memory
+// Databases", ICDE 2013). Keys are byte strings that compare like the values they encode, and no key is a prefix of
+// another one.
+//
+// The tree is built once from the sorted keys and does not change afterwards. The positions of all rows are stored in
+// the order of their keys, so each node refers to the contiguous range [begin(), end()) of the positions of the keys in
+// its subtree. A lookup thus returns an iterator into the positions, and range lookups need no traversal of leaves.
+//
+// Inner nodes use path compression: the bytes that all keys of a subtree share are stored once in the node (its
+// prefix), instead of in a chain of nodes with a single child. Depending on their number of children, inner nodes
+// are one of four sizes, which keeps sparse nodes small and dense nodes fast.
+using AdaptiveRadixTreeKey = std::vector<uint8_t>;
+
+class ARTNode : private Noncopyable {
+ public:
+  using Iterator = BaseIndex::Iterator;
+
+  ARTNode(const Iterator begin, const Iterator end);
+  virtual ~ARTNode() = default;
+
+  // Returns an iterator to the first position whose key is >= the given one, or end() if there is none. depth is the
+  // number of bytes of the key that have been consumed by the ancestors of the node.
+  virtual Iterator lower_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const = 0;
+
+  // returns an iterator to the first position whose key is > the given one, or end() if there is none
+  virtual Iterator upper_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const = 0;
+
+  // returns the range of the positions of the keys in the subtree
+  Iterator begin() const;
+  Iterator end() const;
+
+  // returns the number of bytes used by the subtree
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  Iterator _begin;
+  Iterator _end;
+};
+
+// A leaf holds a single key, which is stored completely, and the range of the positions with that key
+class ARTLeaf : public ARTNode {
+ public:
+  ARTLeaf(AdaptiveRadixTreeKey key, const Iterator begin, const Iterator end);
+
+  Iterator lower_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const override;
+  Iterator upper_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const override;
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  AdaptiveRadixTreeKey _key;
+};
+
+// The children of an inner node, ordered by the byte of the key that leads to them
+using ARTChildren = std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>>;
+
+class ARTInnerNode : public ARTNode {
+ public:
+  ARTInnerNode(AdaptiveRadixTreeKey prefix, const Iterator begin, const Iterator end);
+
+  Iterator lower_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const override;
+  Iterator upper_bound(const AdaptiveRadixTreeKey& key, const size_t depth) const override;
+
+ protected:
+  // returns the child for the given key byte, or nullptr if there is none
+  virtual const ARTNode* _child(const uint8_t key_byte) const = 0;
+
+  // returns the first child for a key byte > the given one, or nullptr if there is none
+  virtual const ARTNode* _next_child(const uint8_t key_byte) const = 0;
+
+  template <bool IsUpperBound>
+  Iterator _bound(const AdaptiveRadixTreeKey& key, const size_t depth) const;
+
+  // the bytes that all keys of the subtree share after depth
+  AdaptiveRadixTreeKey _prefix;
+};
+
+// Node4 and Node16 keep up to Capacity key bytes in a sorted array, next to the children
+template <size_t Capacity>
+class ARTSortedNode : public ARTInnerNode {
+ public:
+  ARTSortedNode(AdaptiveRadixTreeKey prefix, ARTChildren&& children, const Iterator begin, const Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const ARTNode* _child(const uint8_t key_byte) const override;
+  const ARTNode* _next_child(const uint8_t key_byte) const override;
+
+  uint8_t _child_count;
+  std::array<uint8_t, Capacity> _key_bytes{};
+  std::array<std::unique_ptr<ARTNode>, Capacity> _children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+// Node48 maps each key byte to the index of its child in an array of 48 children
+class ARTNode48 : public ARTInnerNode {
+ public:
+  ARTNode48(AdaptiveRadixTreeKey prefix, ARTChildren&& children, const Iterator begin, const Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const ARTNode* _child(const uint8_t key_byte) const override;
+  const ARTNode* _next_child(const uint8_t key_byte) const override;
+
+  static constexpr uint8_t NO_CHILD = 255;
+
+  std::array<uint8_t, 256> _child_indices;
+  std::array<std::unique_ptr<ARTNode>, 48> _children;
+};
+
+// Node256 holds one (possibly empty) child per key byte
+class ARTNode256 : public ARTInnerNode {
+ public:
+  ARTNode256(AdaptiveRadixTreeKey prefix, ARTChildren&& children, const Iterator begin, const Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const ARTNode* _child(const uint8_t key_byte) const override;
+  const ARTNode* _next_child(const uint8_t key_byte) const override;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children;
+};
+
+// creates the smallest inner node that fits the given (at least two) children
+std::unique_ptr<ARTNode> make_art_inner_node(AdaptiveRadixTreeKey prefix, ARTChildren&& children,
+                                             const ARTNode::Iterator begin, const ARTNode::Iterator end);
+
+}  // namespace opossum
@@ -1,9 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+
 #include "types.hpp"
 
 namespace opossum {
 
+// number of value ids that are decoded at once by BaseAttributeVector::decode_block
+constexpr size_t ATTRIBUTE_VECTOR_BLOCK_SIZE = 128;
+
+using ValueIDBlock = std::array<ValueID, ATTRIBUTE_VECTOR_BLOCK_SIZE>;
+
 // BaseAttributeVector is the abstract super class for all attribute vectors,
 // e.g., FittedAttributeVector
 class BaseAttributeVector : private Noncopyable {
@@ -27,5 +35,19 @@ class BaseAttributeVector : private Noncopyable {
 
   // returns the width of biggest value id in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the number of bytes used by the attribute vector
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // Decodes up to ATTRIBUTE_VECTOR_BLOCK_SIZE consecutive value ids starting at offset into out and returns the number
+  // of decoded value ids. Scans should prefer this over get() as it saves a virtual call per value. Subclasses should
+  // override it with a faster implementation than the default one.
+  virtual size_t decode_block(const size_t offset, ValueIDBlock& out) const {
+    const auto count = std::min(ATTRIBUTE_VECTOR_BLOCK_SIZE, size() - offset);
+    for (size_t index = 0; index < count; ++index) {
+      out[index] = get(offset + index);
+    }
+    return count;
+  }
 };
 }  // namespace opossum
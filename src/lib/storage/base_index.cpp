@@ -0,0 +1,36 @@
+#include "base_index.hpp"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const SegmentIndexType type) : _type(type) {}
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  // an index that has fewer positions than its segment has rows is outdated, as values have been appended since
+  return _get_indexed_segments() == segments &&
+         (segments.empty() || static_cast<size_t>(std::distance(cbegin(), cend())) == segments.front()->size());
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() == _get_indexed_segments().size(), "one value per indexed segment is needed");
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() == _get_indexed_segments().size(), "one value per indexed segment is needed");
+  return _upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+SegmentIndexType BaseIndex::type() const { return _type; }
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// BaseIndex is the abstract super class for all indexes on the segments of a chunk, e.g., GroupKeyIndex. Indexes are
+// created through Chunk::create_index.
+//
+// An index holds the positions of all rows of its segments, ordered by their values. Positions of rows with the same
+// value are in ascending order. lower_bound and upper_bound find the range of positions for a search value, so that,
+// e.g., the rows with values < x are [cbegin(), lower_bound({x})) and the rows with value x are
+// [lower_bound({x}), upper_bound({x})). Thus, scans with selective predicates find their rows without reading the
+// segments.
+//
+// An index keeps its segments alive. If a segment is replaced (e.g., by compress_chunk), the index does not apply to
+// the new one anymore, see is_index_for.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit BaseIndex(const SegmentIndexType type);
+  virtual ~BaseIndex() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // returns whether the index covers exactly the given segments, in that order, including all of their rows
+  bool is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
+
+  // returns an iterator to the position of the first row whose values are >= the given ones (one per segment)
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns an iterator to the position of the first row whose values are > the given ones (one per segment)
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the range of all positions, ordered by their values
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  SegmentIndexType type() const;
+
+  // returns the number of bytes used by the index, without its segments
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const = 0;
+
+ private:
+  SegmentIndexType _type;
+};
+
+}  // namespace opossum
@@ -1,13 +1,36 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+// The smallest and the biggest value of a segment. Scans use it to skip segments in which no value can match.
+struct ZoneMap {
+  AllTypeVariant min;
+  AllTypeVariant max;
+};
+
+// Returns the number of bytes allocated by a vector of values. For strings, this includes the characters of strings
+// that are too long to be stored inline.
+template <typename T, typename Allocator>
+size_t estimate_values_memory_usage(const std::vector<T, Allocator>& values) {
+  auto memory_usage = values.capacity() * sizeof(T);
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto inline_capacity = std::string{}.capacity();
+    for (const auto& value : values) {
+      if (value.capacity() > inline_capacity) memory_usage += value.capacity() + 1;
+    }
+  }
+  return memory_usage;
+}
+
 // BaseSegment is the abstract super class for all segment types,
 // e.g., ValueSegment, ReferenceSegment
 class BaseSegment : private Noncopyable {
@@ -28,5 +51,16 @@ class BaseSegment : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // returns the concrete class of the segment, so that operators can dispatch on it without RTTI (see
+  // resolve_segment_type)
+  virtual SegmentType segment_type() const = 0;
+
+  // returns the zone map of the segment, or std::nullopt if the segment is empty or does not keep one
+  virtual std::optional<ZoneMap> zone_map() const { return std::nullopt; }
+
+  // Returns the number of bytes used by the segment, including the data structures it owns. Data structures that are
+  // shared with other segments (e.g., shared dictionaries or position lists) are counted for each of them.
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
@@ -0,0 +1,118 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "fitted_attribute_vector.hpp"
+#include "simd_bp128_attribute_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t WORD_BITS = std::numeric_limits<uint64_t>::digits;
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const ValueID max_value,
+                                                   const PolymorphicAllocator<uint64_t>& allocator)
+    : _size(size),
+      _bits_per_value(bits_needed(max_value)),
+      _mask(std::numeric_limits<uint64_t>::max() >> (WORD_BITS - _bits_per_value)),
+      _words((size * _bits_per_value + WORD_BITS - 1) / WORD_BITS + 1, allocator) {}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value,
+                                                   pmr_vector<uint64_t>&& words)
+    : _size(size),
+      _bits_per_value(bits_per_value),
+      _mask(std::numeric_limits<uint64_t>::max() >> (WORD_BITS - _bits_per_value)),
+      _words(std::move(words)) {
+  Assert(_bits_per_value > 0 && _bits_per_value <= std::numeric_limits<uint32_t>::digits, "invalid number of bits");
+  Assert(_words.size() == (size * _bits_per_value + WORD_BITS - 1) / WORD_BITS + 1, "words do not match the size");
+}
+
+uint32_t BitPackedAttributeVector::_extract(const size_t bit_offset) const {
+  const auto word_index = bit_offset / WORD_BITS;
+  const auto bit_shift = bit_offset % WORD_BITS;
+
+  // The second shift is split up so that it does not become a shift by 64 (which is undefined) if the value id is
+  // completely stored in the first word.
+  const auto low_bits = _words[word_index] >> bit_shift;
+  const auto high_bits = (_words[word_index + 1] << 1) << (WORD_BITS - 1 - bit_shift);
+  return static_cast<uint32_t>((low_bits | high_bits) & _mask);
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "index out of range");
+  return ValueID{_extract(i * _bits_per_value)};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  Assert(i < _size, "index out of range");
+  Assert(static_cast<uint64_t>(value_id) <= _mask, "value_id can not be stored");
+
+  const auto bit_offset = i * _bits_per_value;
+  const auto word_index = bit_offset / WORD_BITS;
+  const auto bit_shift = bit_offset % WORD_BITS;
+  const auto value = static_cast<uint64_t>(value_id);
+
+  _words[word_index] = (_words[word_index] & ~(_mask << bit_shift)) | (value << bit_shift);
+
+  if (bit_shift + _bits_per_value > WORD_BITS) {
+    const auto written_bits = WORD_BITS - bit_shift;
+    _words[word_index + 1] = (_words[word_index + 1] & ~(_mask >> written_bits)) | (value >> written_bits);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const {
+  return sizeof(*this) + _words.capacity() * sizeof(uint64_t);
+}
+
+AttributeVectorWidth BitPackedAttributeVector::width() const {
+  return static_cast<AttributeVectorWidth>((_bits_per_value + 7) / 8);
+}
+
+uint8_t BitPackedAttributeVector::bits_per_value() const { return _bits_per_value; }
+
+const pmr_vector<uint64_t>& BitPackedAttributeVector::words() const { return _words; }
+
+size_t BitPackedAttributeVector::decode_block(const size_t offset, ValueIDBlock& out) const {
+  const auto count = std::min(ATTRIBUTE_VECTOR_BLOCK_SIZE, _size - offset);
+
+  auto bit_offset = offset * _bits_per_value;
+  for (size_t index = 0; index < count; ++index) {
+    out[index] = ValueID{_extract(bit_offset)};
+    bit_offset += _bits_per_value;
+  }
+  return count;
+}
+
+uint8_t bits_needed(const ValueID max_value) {
+  auto bits = uint8_t{1};
+  while (bits < std::numeric_limits<uint32_t>::digits && (static_cast<uint32_t>(max_value) >> bits) != 0) {
+    ++bits;
+  }
+  return bits;
+}
+
+std::shared_ptr<BaseAttributeVector> make_shared_compressed_attribute_vector(
+    const size_t size, const ValueID max_value, const PolymorphicAllocator<size_t>& allocator) {
+  const auto bits = bits_needed(max_value);
+  if (bits % 8 == 0 && bits != 24) {
+    return make_shared_attribute_vector(size, max_value, allocator);
+  }
+
+  if (size >= ATTRIBUTE_VECTOR_BLOCK_SIZE) {
+    return std::make_shared<SimdBp128AttributeVector>(size, max_value, allocator);
+  }
+
+  return std::make_shared<BitPackedAttributeVector>(size, max_value, allocator);
+}
+
+}  // namespace opossum
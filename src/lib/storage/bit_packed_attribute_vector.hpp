@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// BitPackedAttributeVector stores each value id with exactly as many bits as the biggest value id requires, i.e.,
+// ceil(log2(max_value + 1)) bits. The value ids are packed back to back into 64-bit words, so a single value id may
+// span two adjacent words.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  BitPackedAttributeVector(const size_t size, const ValueID max_value,
+                           const PolymorphicAllocator<uint64_t>& allocator = {});
+
+  // creates an attribute vector that takes over the given packed words, e.g., when loading a table
+  BitPackedAttributeVector(const size_t size, const uint8_t bits_per_value, pmr_vector<uint64_t>&& words);
+
+  ValueID get(const size_t i) const override;
+
+  void set(const size_t i, const ValueID value_id) override;
+
+  size_t size() const override;
+
+  AttributeVectorWidth width() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  size_t decode_block(const size_t offset, ValueIDBlock& out) const override;
+
+  // returns the number of bits used to store a single value id
+  uint8_t bits_per_value() const;
+
+  // returns the packed value ids, e.g., to write them to a file
+  const pmr_vector<uint64_t>& words() const;
+
+ protected:
+  const size_t _size;
+  const uint8_t _bits_per_value;
+  const uint64_t _mask;
+
+  // holds one additional padding word so that the word following a value id can always be read
+  pmr_vector<uint64_t> _words;
+
+  uint32_t _extract(const size_t bit_offset) const;
+};
+
+// returns the number of bits that are needed to represent max_value (at least one)
+uint8_t bits_needed(const ValueID max_value);
+
+// Creates the most compact attribute vector for the given max_value. If the value ids need exactly 8, 16, or 32 bits,
+// a FittedAttributeVector is used as it offers the same compression at a cheaper access. Otherwise, the value ids are
+// bit-packed. Vectors holding at least one full block use the SIMD-BP128 layout, which decodes blocks considerably
+// faster, while smaller ones use the BitPackedAttributeVector to avoid padding the block.
+std::shared_ptr<BaseAttributeVector> make_shared_compressed_attribute_vector(
+    const size_t size, const ValueID max_value, const PolymorphicAllocator<size_t>& allocator = {});
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// std::hash is the identity for integers in libstdc++, so the bits of the hash are mixed first (MurmurHash3's
+// finalizer). Otherwise, consecutive values would set neighbouring bits only.
+uint64_t mix(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace
+
+BloomFilter::BloomFilter(const size_t value_count, const double false_positive_rate) {
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "false positive rate must be between 0 and 1");
+
+  // the optimal number of bits is -n * ln(p) / ln(2)^2, the optimal number of hash functions is bits / n * ln(2)
+  const auto ln2 = std::log(2.0);
+  const auto value_count_or_one = static_cast<double>(std::max(value_count, size_t{1}));
+  const auto bit_count = std::ceil(-value_count_or_one * std::log(false_positive_rate) / (ln2 * ln2));
+  _bits.resize(static_cast<size_t>(std::ceil(bit_count / 64.0)));
+  _hash_function_count = std::max(size_t{1}, static_cast<size_t>(std::round(bit_count / value_count_or_one * ln2)));
+}
+
+void BloomFilter::insert(const size_t hash) {
+  const auto mixed_hash = mix(hash);
+  const auto first_hash = mixed_hash & 0xFFFFFFFF;
+  const auto second_hash = mixed_hash >> 32;
+  const auto bits = bit_count();
+
+  for (size_t hash_function = 0; hash_function < _hash_function_count; ++hash_function) {
+    const auto bit = (first_hash + hash_function * second_hash) % bits;
+    _bits[bit / 64] |= uint64_t{1} << (bit % 64);
+  }
+}
+
+bool BloomFilter::may_contain(const size_t hash) const {
+  const auto mixed_hash = mix(hash);
+  const auto first_hash = mixed_hash & 0xFFFFFFFF;
+  const auto second_hash = mixed_hash >> 32;
+  const auto bits = bit_count();
+
+  for (size_t hash_function = 0; hash_function < _hash_function_count; ++hash_function) {
+    const auto bit = (first_hash + hash_function * second_hash) % bits;
+    if (!(_bits[bit / 64] & (uint64_t{1} << (bit % 64)))) return false;
+  }
+  return true;
+}
+
+size_t BloomFilter::bit_count() const { return _bits.size() * 64; }
+
+size_t BloomFilter::estimate_memory_usage() const { return sizeof(*this) + _bits.capacity() * sizeof(uint64_t); }
+
+size_t BloomFilter::hash_function_count() const { return _hash_function_count; }
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// BloomFilter is a compact, probabilistic set of hash values. may_contain() never returns false for an inserted hash,
+// but may return true for hashes that were never inserted (false positives). Scans use it to skip segments that
+// cannot contain the search value, which zone maps cannot do for high-cardinality columns such as UUIDs.
+//
+// Each hash is mapped to hash_function_count() bits, which are derived from a single 64-bit hash by double hashing.
+class BloomFilter : private Noncopyable {
+ public:
+  // creates a filter that holds up to value_count values with roughly the given false positive rate
+  explicit BloomFilter(const size_t value_count, const double false_positive_rate = 0.01);
+
+  // adds a hash to the filter
+  void insert(const size_t hash);
+
+  // returns false if the hash has definitely not been inserted
+  bool may_contain(const size_t hash) const;
+
+  // returns the number of bits of the filter
+  size_t bit_count() const;
+
+  // returns the number of bits set per hash
+  size_t hash_function_count() const;
+
+  // returns the number of bytes used by the filter
+  size_t estimate_memory_usage() const;
+
+ protected:
+  std::vector<uint64_t> _bits;
+  size_t _hash_function_count;
+};
+
+// returns the hash that is inserted into and looked up in BloomFilters for the given value
+// std::string and std::string_view have the same hash, so either can be used for strings
+template <typename T>
+size_t bloom_filter_hash(const T& value) {
+  return std::hash<T>{}(value);
+}
+
+// creates a BloomFilter that contains all of the given values (e.g., a std::vector or a StringHeap)
+template <typename Values>
+std::shared_ptr<BloomFilter> make_bloom_filter(const Values& values) {
+  auto bloom_filter = std::make_shared<BloomFilter>(values.size());
+  for (const auto& value : values) {
+    bloom_filter->insert(bloom_filter_hash(value));
+  }
+  return bloom_filter;
+}
+
+}  // namespace opossum
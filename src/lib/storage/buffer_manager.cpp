@@ -0,0 +1,296 @@
+#include "buffer_manager.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/binary_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns the dictionary (a DictionaryType<T>) of a DictionarySegment, nullptr for other segments
+std::shared_ptr<const void> segment_dictionary(const std::string& column_type, const BaseSegment& segment) {
+  auto dictionary = std::shared_ptr<const void>{};
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment)) {
+      dictionary = dictionary_segment->dictionary();
+    }
+  });
+  return dictionary;
+}
+
+// re-encodes a DictionarySegment with the given dictionary (a DictionaryType<T>), which contains all of its values
+std::shared_ptr<BaseSegment> reencode_segment(const std::string& column_type, const BaseSegment& segment,
+                                              const std::shared_ptr<const void>& dictionary,
+                                              std::pmr::memory_resource* memory_resource) {
+  auto reencoded_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto& dictionary_segment = static_cast<const DictionarySegment<ColumnDataType>&>(segment);
+    const auto typed_dictionary = std::static_pointer_cast<const DictionaryType<ColumnDataType>>(dictionary);
+    reencoded_segment = std::make_shared<DictionarySegment<ColumnDataType>>(
+        dictionary_segment, typed_dictionary,
+        map_value_ids<ColumnDataType>(*dictionary_segment.dictionary(), *typed_dictionary),
+        PolymorphicAllocator<ColumnDataType>{memory_resource});
+  });
+  return reencoded_segment;
+}
+
+}  // namespace
+
+BufferManager::BufferManager(const std::vector<std::string>& column_types, const size_t memory_budget,
+                             const std::string& spill_file_name, std::pmr::memory_resource* memory_resource)
+    : _column_types(column_types),
+      _memory_budget(memory_budget),
+      _spill_file_name(spill_file_name),
+      _memory_resource(memory_resource),
+      _shared_dictionaries(column_types.size()) {
+  _spill_file_descriptor = open(spill_file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  Assert(_spill_file_descriptor >= 0, "Could not open spill file " + spill_file_name);
+}
+
+BufferManager::~BufferManager() {
+  // prefetches restore their chunk when they are done, so they need the mutex
+  auto loads = std::vector<std::shared_future<Segments>>();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& frame : _frames) {
+      if (frame && frame->load.valid()) loads.push_back(frame->load);
+    }
+  }
+  for (const auto& load : loads) load.wait();
+
+  close(_spill_file_descriptor);
+  unlink(_spill_file_name.c_str());
+}
+
+void BufferManager::register_chunk(Chunk& chunk, const ChunkID chunk_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_frames.size() <= static_cast<size_t>(chunk_id)) _frames.resize(chunk_id + 1);
+  if (_frames[chunk_id]) return;
+  for (const auto& segment : chunk._columns) {
+    if (std::dynamic_pointer_cast<ReferenceSegment>(std::atomic_load(&segment))) return;
+  }
+
+  chunk._set_buffer_manager(this, chunk_id);
+  _frames[chunk_id] = Frame{};
+  _frames[chunk_id]->chunk = &chunk;
+  _evict_chunks(std::nullopt);
+}
+
+void BufferManager::register_shared_dictionary(const ColumnID column_id,
+                                               const std::shared_ptr<const void>& dictionary) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  // replaced dictionaries are forgotten once neither a segment nor a spilled chunk refers to them anymore
+  auto& dictionaries = _shared_dictionaries.at(column_id);
+  dictionaries.erase(std::remove_if(dictionaries.begin(), dictionaries.end(),
+                                    [](const auto& registered_dictionary) { return registered_dictionary.expired(); }),
+                     dictionaries.end());
+  dictionaries.emplace_back(dictionary);
+}
+
+void BufferManager::reference_chunk(const ChunkID chunk_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (static_cast<size_t>(chunk_id) < _frames.size() && _frames[chunk_id]) _frames[chunk_id]->is_referenced = true;
+}
+
+std::vector<std::shared_ptr<BaseSegment>> BufferManager::load_chunk(const ChunkID chunk_id) {
+  auto load = std::shared_future<Segments>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Assert(static_cast<size_t>(chunk_id) < _frames.size() && _frames[chunk_id],
+           "chunk is not managed by the buffer manager");
+    auto& frame = *_frames[chunk_id];
+    frame.is_referenced = true;
+    if (frame.is_resident) {
+      auto segments = Segments();
+      for (const auto& segment : frame.chunk->_columns) segments.push_back(std::atomic_load(&segment));
+      return segments;
+    }
+
+    // if the chunk is being prefetched, the prefetch is waited for, otherwise the chunk is loaded by this thread
+    load = _start_load(chunk_id, std::launch::deferred);
+  }
+  return load.get();
+}
+
+void BufferManager::prefetch_chunk(const ChunkID chunk_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (static_cast<size_t>(chunk_id) >= _frames.size() || !_frames[chunk_id] || _frames[chunk_id]->is_resident) return;
+  _start_load(chunk_id, std::launch::async);
+}
+
+void BufferManager::evict_chunks() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _evict_chunks(std::nullopt);
+}
+
+bool BufferManager::is_chunk_resident(const ChunkID chunk_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return static_cast<size_t>(chunk_id) >= _frames.size() || !_frames[chunk_id] || _frames[chunk_id]->is_resident;
+}
+
+size_t BufferManager::memory_budget() const { return _memory_budget; }
+
+size_t BufferManager::memory_usage() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_usage();
+}
+
+std::shared_future<BufferManager::Segments> BufferManager::_start_load(const ChunkID chunk_id,
+                                                                      const std::launch policy) {
+  auto& frame = *_frames[chunk_id];
+  if (!frame.load.valid()) {
+    const auto spill_range = *frame.spill_range;
+    const auto shared_dictionaries = frame.spilled_dictionaries;
+    frame.load = std::async(policy, [this, chunk_id, spill_range, shared_dictionaries]() {
+                   return _load(chunk_id, spill_range, shared_dictionaries);
+                 }).share();
+  }
+  return frame.load;
+}
+
+std::vector<std::shared_ptr<BaseSegment>> BufferManager::_load(
+    const ChunkID chunk_id, const std::pair<size_t, size_t> spill_range,
+    const std::vector<std::shared_ptr<const void>>& shared_dictionaries) {
+  // The file is read without holding the mutex. The buffer is made up of u64s, as the arrays in the chunk are aligned
+  // to 8 bytes.
+  const auto [offset, size] = spill_range;
+  auto buffer = std::vector<uint64_t>((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+  auto data = reinterpret_cast<char*>(buffer.data());
+  for (size_t read_size = 0; read_size < size;) {
+    const auto result = pread(_spill_file_descriptor, data + read_size, size - read_size,
+                              static_cast<off_t>(offset + read_size));
+    Assert(result > 0, "Could not read from spill file " + _spill_file_name);
+    read_size += static_cast<size_t>(result);
+  }
+  const auto segments = read_binary_chunk(data, size, _column_types, shared_dictionaries, _memory_resource);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& frame = *_frames[chunk_id];
+  DebugAssert(!frame.is_resident, "chunk has been restored twice");
+  frame.is_resident = true;
+  frame.is_referenced = true;
+  frame.spilled_segments.assign(segments.cbegin(), segments.cend());
+
+  // If the shared dictionary of a column has been rebuilt while the chunk was evicted, the chunk's segment still uses
+  // the old one, so it is re-encoded with the latest one (see Table::enable_shared_dictionary). This is done while
+  // the mutex is held, so that the dictionary cannot be replaced once more in the meantime.
+  auto current_segments = segments;
+  for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+    if (!shared_dictionaries[column_id]) continue;
+    const auto dictionary = _shared_dictionaries[column_id].back().lock();
+    if (!dictionary || dictionary == shared_dictionaries[column_id]) continue;
+    current_segments[column_id] =
+        reencode_segment(_column_types[column_id], *segments[column_id], dictionary, _memory_resource);
+  }
+  const auto restored_segments = frame.chunk->_restore_segments(current_segments);
+  _evict_chunks(chunk_id);
+  return restored_segments;
+}
+
+void BufferManager::_evict_chunks(const std::optional<ChunkID> protected_chunk_id) {
+  auto memory_usage = _memory_usage();
+  if (memory_usage <= _memory_budget) return;
+
+  auto evictable_chunk_count = std::count_if(_frames.cbegin(), _frames.cend(), [](const auto& frame) {
+    return frame && frame->is_resident;
+  });
+  if (protected_chunk_id && _frames[*protected_chunk_id]->is_resident) --evictable_chunk_count;
+
+  // Each evictable chunk is reached within two turns of the clock hand: the first one clears its reference bit.
+  while (memory_usage > _memory_budget && evictable_chunk_count > 0) {
+    const auto chunk_id = ChunkID{static_cast<uint32_t>(_clock_hand)};
+    _clock_hand = (_clock_hand + 1) % _frames.size();
+
+    auto& frame = _frames[chunk_id];
+    if (!frame || !frame->is_resident || chunk_id == protected_chunk_id) continue;
+    if (frame->is_referenced) {
+      frame->is_referenced = false;
+      continue;
+    }
+
+    for (const auto& segment : frame->chunk->_columns) {
+      memory_usage -= std::atomic_load(&segment)->estimate_memory_usage();
+    }
+    _evict(*frame);
+    --evictable_chunk_count;
+  }
+}
+
+void BufferManager::_evict(Frame& frame) {
+  const auto segments = frame.chunk->_release_segments();
+
+  auto is_spilled = frame.spill_range.has_value();
+  for (auto column_id = ColumnID{0}; is_spilled && column_id < segments.size(); ++column_id) {
+    is_spilled = segments[column_id] == frame.spilled_segments[column_id].lock();
+  }
+
+  if (!is_spilled) {
+    try {
+      // segments that use a registered shared dictionary are written without it, the frame keeps it alive instead
+      auto shared_dictionaries = std::vector<std::shared_ptr<const void>>(segments.size());
+      for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+        const auto dictionary = segment_dictionary(_column_types[column_id], *segments[column_id]);
+        for (const auto& shared_dictionary : _shared_dictionaries[column_id]) {
+          if (dictionary && shared_dictionary.lock() == dictionary) shared_dictionaries[column_id] = dictionary;
+        }
+      }
+
+      auto stream = std::ostringstream{};
+      write_binary_chunk(stream, segments, _column_types, shared_dictionaries);
+      const auto data = stream.str();
+
+      // each chunk starts at an aligned offset, which keeps the arrays within it aligned as well
+      const auto offset = (_spill_file_size + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+      for (size_t written_size = 0; written_size < data.size();) {
+        const auto result = pwrite(_spill_file_descriptor, data.data() + written_size, data.size() - written_size,
+                                   static_cast<off_t>(offset + written_size));
+        Assert(result > 0, "Could not write to spill file " + _spill_file_name);
+        written_size += static_cast<size_t>(result);
+      }
+      _spill_file_size = offset + data.size();
+      frame.spill_range = std::make_pair(offset, data.size());
+      frame.spilled_segments.assign(segments.cbegin(), segments.cend());
+      frame.spilled_dictionaries = std::move(shared_dictionaries);
+    } catch (...) {
+      // the chunk stays in memory if it could not be written
+      frame.chunk->_restore_segments(segments);
+      throw;
+    }
+  }
+
+  frame.is_resident = false;
+  frame.load = {};
+}
+
+size_t BufferManager::_memory_usage() const {
+  auto memory_usage = size_t{0};
+  for (const auto& frame : _frames) {
+    if (!frame || !frame->is_resident) continue;
+    for (const auto& segment : frame->chunk->_columns) {
+      memory_usage += std::atomic_load(&segment)->estimate_memory_usage();
+    }
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+// The BufferManager keeps the full chunks of a table within a memory budget. When the segments of the resident chunks
+// use more memory than the budget allows, chunks are evicted to a spill file on local disk. Which chunks are evicted
+// is decided by the CLOCK policy: every access sets a reference bit, and the clock hand evicts the first resident chunk
+// whose bit is not set, clearing the bits it passes.
+//
+// Chunks are spilled in their encoded form, so they use as much memory after being loaded back as before. Segments
+// that use a shared dictionary (see Table::enable_shared_dictionary) are spilled without it and refer to the same
+// dictionary again when they are loaded. If the dictionary has been rebuilt in the meantime, they are re-encoded with
+// the latest one instead. Chunks with ReferenceSegments are never evicted, as they could only be spilled as the values
+// they refer to.
+//
+// Evicted chunks are loaded back when one of their segments is requested (see Chunk::get_segment). Loads read the
+// spill file with pread, so prefetch_chunk can load chunks in the background while the caller works on another one.
+// Readers that still hold a segment of an evicted chunk keep it alive, so eviction never invalidates segments in use.
+//
+// A chunk is only written to the spill file again if its segments have been replaced (e.g., by compress_chunk) since
+// it was last written. The space of outdated copies is not reused, and the spill file is removed with the manager.
+class BufferManager : private Noncopyable {
+ public:
+  BufferManager(const std::vector<std::string>& column_types, size_t memory_budget, const std::string& spill_file_name,
+                std::pmr::memory_resource* memory_resource);
+
+  // waits for all prefetches and removes the spill file
+  ~BufferManager();
+
+  // Makes a full chunk evictable and evicts chunks if the budget is exceeded. Chunks that are already registered and
+  // chunks with ReferenceSegments are ignored. The chunk must not move in memory from now on.
+  void register_chunk(Chunk& chunk, ChunkID chunk_id);
+
+  // Registers a dictionary that the DictionarySegments of the given column share. It has to be registered before any
+  // segment uses it, so that no such segment is spilled with its own copy of the dictionary.
+  void register_shared_dictionary(ColumnID column_id, const std::shared_ptr<const void>& dictionary);
+
+  // marks the chunk as recently used, so that the clock hand passes it once more before it is evicted
+  void reference_chunk(ChunkID chunk_id);
+
+  // returns the segments of the chunk, loading them from the spill file if the chunk has been evicted
+  std::vector<std::shared_ptr<BaseSegment>> load_chunk(ChunkID chunk_id);
+
+  // starts loading the chunk in the background if it has been evicted and is not being loaded yet
+  void prefetch_chunk(ChunkID chunk_id);
+
+  // evicts chunks until the resident chunks fit into the memory budget
+  void evict_chunks();
+
+  // returns whether the segments of the chunk are in memory, unregistered chunks are always resident
+  bool is_chunk_resident(ChunkID chunk_id) const;
+
+  size_t memory_budget() const;
+
+  // returns the number of bytes used by the segments of the resident, evictable chunks
+  size_t memory_usage() const;
+
+ protected:
+  using Segments = std::vector<std::shared_ptr<BaseSegment>>;
+
+  struct Frame {
+    Chunk* chunk = nullptr;
+    bool is_resident = true;
+    bool is_referenced = true;
+
+    // location of the latest copy in the spill file, and the segments that were written there
+    std::optional<std::pair<size_t, size_t>> spill_range;
+    std::vector<std::weak_ptr<BaseSegment>> spilled_segments;
+
+    // the shared dictionary that each spilled segment refers to, nullptr if it has been spilled with its dictionary
+    std::vector<std::shared_ptr<const void>> spilled_dictionaries;
+
+    // set while the chunk is being loaded (or prefetched), until it is evicted again
+    std::shared_future<Segments> load;
+  };
+
+  std::shared_future<Segments> _start_load(ChunkID chunk_id, std::launch policy);
+  Segments _load(ChunkID chunk_id, std::pair<size_t, size_t> spill_range,
+                 const std::vector<std::shared_ptr<const void>>& shared_dictionaries);
+  void _evict_chunks(std::optional<ChunkID> protected_chunk_id);
+  void _evict(Frame& frame);
+  size_t _memory_usage() const;
+
+  const std::vector<std::string> _column_types;
+  const size_t _memory_budget;
+  const std::string _spill_file_name;
+  std::pmr::memory_resource* const _memory_resource;
+  int _spill_file_descriptor;
+  size_t _spill_file_size = 0;
+
+  // guards all members below, chunks are only evicted and restored while it is held
+  mutable std::mutex _mutex;
+  std::deque<std::optional<Frame>> _frames;
+  size_t _clock_hand = 0;
+
+  // the registered shared dictionaries of each column, including replaced ones that segments might still use
+  std::vector<std::vector<std::weak_ptr<const void>>> _shared_dictionaries;
+};
+
+}  // namespace opossum
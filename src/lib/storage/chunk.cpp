@@ -1,13 +1,18 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base_index.hpp"
 #include "base_segment.hpp"
+#include "bloom_filter.hpp"
+#include "buffer_manager.hpp"
 #include "chunk.hpp"
 
 #include "utils/assert.hpp"
@@ -18,6 +23,8 @@ void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
   DebugAssert(column_count() < std::numeric_limits<std::uint16_t>::max(), "max number of segments reached");
 
   _columns.push_back(segment);
+  _bloom_filters.push_back(nullptr);
+  _sort_modes.push_back(std::nullopt);
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
@@ -26,12 +33,124 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   for (size_t i = 0; i < values.size(); ++i) {
     _columns[i]->append(values[i]);
   }
+  std::fill(_sort_modes.begin(), _sort_modes.end(), std::nullopt);
 }
 
-std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _columns.at(column_id); }
+std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
+  auto segment = std::atomic_load(&_columns.at(column_id));
+  if (segment || !_buffer_manager) return segment;
+
+  // the chunk has been evicted
+  return _buffer_manager->load_chunk(_chunk_id).at(column_id);
+}
+
+std::optional<ZoneMap> Chunk::zone_map(ColumnID column_id) const {
+  if (_buffer_manager) return _evictable_zone_maps.at(column_id);
+  return get_segment(column_id)->zone_map();
+}
+
+std::optional<SortMode> Chunk::sorted_by(ColumnID column_id) const { return _sort_modes.at(column_id); }
+
+void Chunk::set_sorted_by(ColumnID column_id, std::optional<SortMode> sort_mode) {
+  _sort_modes.at(column_id) = sort_mode;
+}
+
+std::shared_ptr<const BloomFilter> Chunk::bloom_filter(ColumnID column_id) const {
+  return std::atomic_load(&_bloom_filters.at(column_id));
+}
+
+void Chunk::set_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter) {
+  std::atomic_store(&_bloom_filters.at(column_id), bloom_filter);
+}
+
+std::shared_ptr<BaseIndex> Chunk::get_index(SegmentIndexType index_type,
+                                            const std::vector<ColumnID>& column_ids) const {
+  for (const auto& index : get_indexes(column_ids)) {
+    if (index->type() == index_type) return index;
+  }
+  return nullptr;
+}
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
+  auto indexes = std::vector<std::shared_ptr<BaseIndex>>();
+  if (_indexes.empty()) return indexes;
+
+  const auto segments = _get_segments(column_ids);
+  for (const auto& index : _indexes) {
+    if (index->is_index_for(segments)) indexes.push_back(index);
+  }
+  return indexes;
+}
+
+void Chunk::replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(segment->size() == size(), "replacing segment has a different size");
+
+  std::atomic_store(&_columns.at(column_id), segment);
+}
+
+size_t Chunk::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _columns.capacity() * sizeof(std::shared_ptr<BaseSegment>) +
+                      _bloom_filters.capacity() * sizeof(std::shared_ptr<const BloomFilter>);
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    memory_usage += estimate_memory_usage(column_id);
+  }
+  for (const auto& index : _indexes) memory_usage += index->estimate_memory_usage();
+  return memory_usage;
+}
+
+size_t Chunk::estimate_memory_usage(ColumnID column_id) const {
+  const auto segment = std::atomic_load(&_columns.at(column_id));
+  const auto bloom_filter = this->bloom_filter(column_id);
+  return (segment ? segment->estimate_memory_usage() : 0) +
+         (bloom_filter ? bloom_filter->estimate_memory_usage() : 0);
+}
 
 uint16_t Chunk::column_count() const { return static_cast<uint16_t>(_columns.size()); }
 
-uint32_t Chunk::size() const { return column_count() > 0 ? static_cast<uint32_t>(_columns[0]->size()) : 0; }
+uint32_t Chunk::size() const {
+  if (_buffer_manager) return _evictable_size;
+  return column_count() > 0 ? static_cast<uint32_t>(get_segment(ColumnID{0})->size()) : 0;
+}
+
+void Chunk::_set_buffer_manager(BufferManager* buffer_manager, ChunkID chunk_id) {
+  _evictable_size = size();
+  _evictable_zone_maps.clear();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    _evictable_zone_maps.push_back(zone_map(column_id));
+  }
+  _chunk_id = chunk_id;
+  _buffer_manager = buffer_manager;
+}
+
+std::vector<std::shared_ptr<BaseSegment>> Chunk::_release_segments() {
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>();
+  for (auto& segment : _columns) {
+    segments.push_back(std::atomic_exchange(&segment, std::shared_ptr<BaseSegment>{}));
+  }
+  return segments;
+}
+
+std::vector<std::shared_ptr<BaseSegment>> Chunk::_restore_segments(
+    const std::vector<std::shared_ptr<BaseSegment>>& segments) {
+  DebugAssert(segments.size() == _columns.size(), "one segment per column is needed");
+
+  auto restored_segments = std::vector<std::shared_ptr<BaseSegment>>();
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    auto segment = std::shared_ptr<BaseSegment>{};
+    if (!std::atomic_compare_exchange_strong(&_columns[column_id], &segment, segments[column_id])) {
+      // the segment has been replaced while the chunk was evicted, e.g., by compress_chunk
+      restored_segments.push_back(segment);
+      continue;
+    }
+    restored_segments.push_back(segments[column_id]);
+  }
+  return restored_segments;
+}
+
+std::vector<std::shared_ptr<const BaseSegment>> Chunk::_get_segments(const std::vector<ColumnID>& column_ids) const {
+  auto segments = std::vector<std::shared_ptr<const BaseSegment>>();
+  for (const auto& column_id : column_ids) segments.push_back(get_segment(column_id));
+  return segments;
+}
 
 }  // namespace opossum
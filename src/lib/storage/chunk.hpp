@@ -5,21 +5,28 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "base_segment.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class BloomFilter;
+class BufferManager;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
 //
 // Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/chunk-concept
+//
+// Full chunks of a table can be evicted from memory by a BufferManager (see Table::enable_eviction). An evicted chunk
+// keeps its size and zone maps, and get_segment transparently loads its segments back.
 class Chunk : private Noncopyable {
  public:
   Chunk() = default;
@@ -42,11 +49,85 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
-  // Returns the segment at a given position
+  // Returns the segment at a given position, loading the chunk if it has been evicted
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Returns the smallest and the biggest value of the segment at a given position, if known. The zone maps of evictable
+  // chunks are kept in memory, so that scans can skip evicted chunks without loading them.
+  std::optional<ZoneMap> zone_map(ColumnID column_id) const;
+
+  // Returns the Bloom filter of the segment at a given position, or nullptr if there is none
+  std::shared_ptr<const BloomFilter> bloom_filter(ColumnID column_id) const;
+
+  // Sets the Bloom filter of the segment at a given position. Like replace_segment, this is safe for concurrent
+  // readers.
+  void set_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter);
+
+  // Returns the order of the values of the segment at a given position, or std::nullopt if they are not known to be
+  // sorted. Scans use binary search on sorted segments.
+  std::optional<SortMode> sorted_by(ColumnID column_id) const;
+
+  // Marks the segment at a given position as sorted (or not). The values have to be in that order, see
+  // Table::set_sorted_by and Table::sort_chunk. The flag is kept when the segment is replaced by its compressed
+  // version, and it is cleared when values are appended.
+  void set_sorted_by(ColumnID column_id, std::optional<SortMode> sort_mode);
+
+  // Creates an index of the given type (e.g., GroupKeyIndex) on the segments at the given positions and returns it. The
+  // index refers to the current segments, so it should be created after the chunk has been compressed. An index keeps
+  // its segments in memory, and it does not apply to the segments of an evicted chunk once they are loaded back. Like
+  // appending, this is not thread-safe.
+  template <typename Index>
+  std::shared_ptr<BaseIndex> create_index(const std::vector<ColumnID>& column_ids) {
+    const auto index = std::make_shared<Index>(_get_segments(column_ids));
+    _indexes.emplace_back(index);
+    return index;
+  }
+
+  // Returns the index of the given type on the segments at the given positions, or nullptr if there is none. Indexes
+  // whose segments have been replaced since they were created are not returned.
+  std::shared_ptr<BaseIndex> get_index(SegmentIndexType index_type, const std::vector<ColumnID>& column_ids) const;
+
+  // returns all indexes on the segments at the given positions
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
+
+  // Replaces the segment at a given position, e.g., by its compressed version. The segment is swapped atomically, so
+  // concurrent readers get either the old or the new segment. Readers that still hold the old segment keep it alive.
+  void replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment);
+
+  // returns the number of bytes used by the chunk, i.e., by its segments, Bloom filters, and indexes
+  // segments that have been evicted do not count
+  size_t estimate_memory_usage() const;
+
+  // returns the number of bytes used by the segment and the Bloom filter at a given position
+  size_t estimate_memory_usage(ColumnID column_id) const;
+
  protected:
+  friend class BufferManager;
+
+  // Makes the chunk evictable by the given buffer manager, which refers to it by the given id. Only full chunks, which
+  // are not appended to anymore, can be evicted.
+  void _set_buffer_manager(BufferManager* buffer_manager, ChunkID chunk_id);
+
+  // releases the segments of the chunk and returns them (used to evict the chunk)
+  std::vector<std::shared_ptr<BaseSegment>> _release_segments();
+
+  // Puts back the segments of an evicted chunk. Segments that have been replaced in the meantime are kept. Returns the
+  // segments of the chunk afterwards.
+  std::vector<std::shared_ptr<BaseSegment>> _restore_segments(
+      const std::vector<std::shared_ptr<BaseSegment>>& segments);
+
+  std::vector<std::shared_ptr<const BaseSegment>> _get_segments(const std::vector<ColumnID>& column_ids) const;
+
   std::vector<std::shared_ptr<BaseSegment>> _columns;
+  std::vector<std::shared_ptr<const BloomFilter>> _bloom_filters;
+  std::vector<std::optional<SortMode>> _sort_modes;
+  std::vector<std::shared_ptr<BaseIndex>> _indexes;
+
+  // only set for evictable chunks, which cannot change their size anymore
+  BufferManager* _buffer_manager = nullptr;
+  ChunkID _chunk_id{0};
+  uint32_t _evictable_size = 0;
+  std::vector<std::optional<ZoneMap>> _evictable_zone_maps;
 };
 
 }  // namespace opossum
@@ -0,0 +1,219 @@
+#include "delta_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Zig-zag encoding maps signed differences to unsigned ones so that differences close to zero, both positive and
+// negative, become small numbers: 0, -1, 1, -2, 2, ... are mapped to 0, 1, 2, 3, 4, ...
+// The difference is computed on unsigned values, so that it wraps around instead of overflowing. Decoding wraps back.
+template <typename T>
+std::make_unsigned_t<T> zig_zag_encode(const T value, const T previous_value) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto difference = static_cast<T>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(previous_value));
+  return static_cast<UnsignedT>(static_cast<UnsignedT>(difference) << 1) ^
+         static_cast<UnsignedT>(difference >> (std::numeric_limits<UnsignedT>::digits - 1));
+}
+
+template <typename T>
+T zig_zag_decode(const uint32_t delta, const T previous_value) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto unsigned_delta = static_cast<UnsignedT>(delta);
+  const auto difference = static_cast<UnsignedT>((unsigned_delta >> 1) ^ (~(unsigned_delta & 1) + 1));
+  return static_cast<T>(static_cast<UnsignedT>(previous_value) + difference);
+}
+
+}  // namespace
+
+template <typename T>
+DeltaSegment<T>::DeltaSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _checkpoints(std::make_shared<std::vector<T>>()), _is_sorted(true) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment != nullptr, "DeltaSegment can only be created from a ValueSegment of the same type");
+
+  const auto& values = value_segment->values();
+  _checkpoints->reserve((values.size() + CHECKPOINT_INTERVAL - 1) / CHECKPOINT_INTERVAL);
+
+  // The first pass determines the biggest delta, which defines the width of the attribute vector.
+  auto max_delta = uint32_t{0};
+  for (size_t value_index = 0; value_index < values.size(); ++value_index) {
+    if (value_index % CHECKPOINT_INTERVAL == 0) {
+      _checkpoints->push_back(values[value_index]);
+    } else {
+      const auto delta = zig_zag_encode(values[value_index], values[value_index - 1]);
+      Assert(delta <= std::numeric_limits<uint32_t>::max(), "difference between values is too large for DeltaSegment");
+      max_delta = std::max(max_delta, static_cast<uint32_t>(delta));
+    }
+
+    if (value_index > 0 && values[value_index] < values[value_index - 1]) _is_sorted = false;
+  }
+
+  _deltas = make_shared_compressed_attribute_vector(values.size(), ValueID{max_delta});
+  for (size_t value_index = 0; value_index < values.size(); ++value_index) {
+    if (value_index % CHECKPOINT_INTERVAL == 0) continue;
+    const auto delta = zig_zag_encode(values[value_index], values[value_index - 1]);
+    _deltas->set(value_index, ValueID{static_cast<uint32_t>(delta)});
+  }
+
+  if (!values.empty()) {
+    const auto [min_it, max_it] = std::minmax_element(values.cbegin(), values.cend());
+    _zone_map = ZoneMap{*min_it, *max_it};
+  }
+}
+
+template <typename T>
+bool DeltaSegment<T>::is_encodable(const std::shared_ptr<BaseSegment>& base_segment) {
+  if constexpr (sizeof(T) <= sizeof(uint32_t)) {
+    return true;
+  } else {
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+    Assert(value_segment != nullptr, "DeltaSegment can only be created from a ValueSegment of the same type");
+
+    // differences to checkpoints are not stored
+    const auto& values = value_segment->values();
+    for (size_t value_index = 1; value_index < values.size(); ++value_index) {
+      if (value_index % CHECKPOINT_INTERVAL == 0) continue;
+      if (zig_zag_encode(values[value_index], values[value_index - 1]) > std::numeric_limits<uint32_t>::max()) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+template <typename T>
+DeltaSegment<T>::DeltaSegment(std::shared_ptr<std::vector<T>> checkpoints, std::shared_ptr<BaseAttributeVector> deltas,
+                              const bool is_sorted, std::optional<ZoneMap> zone_map)
+    : _checkpoints(std::move(checkpoints)),
+      _deltas(std::move(deltas)),
+      _is_sorted(is_sorted),
+      _zone_map(std::move(zone_map)) {
+  DebugAssert(_checkpoints->size() == (_deltas->size() + CHECKPOINT_INTERVAL - 1) / CHECKPOINT_INTERVAL,
+              "each block needs a checkpoint");
+}
+
+template <typename T>
+const AllTypeVariant DeltaSegment<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  return get(i);
+}
+
+template <typename T>
+const T DeltaSegment<T>::get(const size_t i) const {
+  DebugAssert(i < size(), "index out of range");
+
+  const auto block_index = i / CHECKPOINT_INTERVAL;
+  auto value = (*_checkpoints)[block_index];
+  for (auto value_index = block_index * CHECKPOINT_INTERVAL + 1; value_index <= i; ++value_index) {
+    value = zig_zag_decode(_deltas->get(value_index), value);
+  }
+  return value;
+}
+
+template <typename T>
+void DeltaSegment<T>::append(const AllTypeVariant&) {
+  Fail("can not append value to DeltaSegment");
+}
+
+template <typename T>
+size_t DeltaSegment<T>::decode_block(const size_t block_index, ValueBlock& values) const {
+  DebugAssert(block_index < _checkpoints->size(), "block index out of range");
+
+  // blocks start at multiples of ATTRIBUTE_VECTOR_BLOCK_SIZE, so all of their deltas are unpacked at once
+  auto deltas = ValueIDBlock{};
+  const auto value_count = _deltas->decode_block(block_index * CHECKPOINT_INTERVAL, deltas);
+
+  values[0] = (*_checkpoints)[block_index];
+  for (size_t index = 1; index < value_count; ++index) {
+    values[index] = zig_zag_decode(deltas[index], values[index - 1]);
+  }
+  return value_count;
+}
+
+template <typename T>
+bool DeltaSegment<T>::is_sorted() const {
+  return _is_sorted;
+}
+
+template <typename T>
+ChunkOffset DeltaSegment<T>::lower_bound(const T value) const {
+  return _bound(value, false);
+}
+
+template <typename T>
+ChunkOffset DeltaSegment<T>::upper_bound(const T value) const {
+  return _bound(value, true);
+}
+
+template <typename T>
+ChunkOffset DeltaSegment<T>::_bound(const T value, const bool is_upper_bound) const {
+  Assert(_is_sorted, "bounds can only be searched in sorted DeltaSegments");
+
+  const auto matches = [&](const T entry) { return is_upper_bound ? entry > value : entry >= value; };
+
+  // The first checkpoint that matches is either the result itself or preceded by it, i.e., the result lies in the
+  // block before that checkpoint.
+  const auto checkpoint_it = std::partition_point(_checkpoints->cbegin(), _checkpoints->cend(),
+                                                  [&](const T checkpoint) { return !matches(checkpoint); });
+  const auto first_block = static_cast<size_t>(std::distance(_checkpoints->cbegin(), checkpoint_it));
+  if (first_block == 0) return ChunkOffset{0};
+
+  auto values = ValueBlock{};
+  const auto block_index = first_block - 1;
+  const auto value_count = decode_block(block_index, values);
+  const auto value_it = std::find_if(values.cbegin() + 1, values.cbegin() + value_count, matches);
+  return static_cast<ChunkOffset>(block_index * CHECKPOINT_INTERVAL + std::distance(values.cbegin(), value_it));
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> DeltaSegment<T>::checkpoints() const {
+  return _checkpoints;
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> DeltaSegment<T>::deltas() const {
+  return _deltas;
+}
+
+template <typename T>
+size_t DeltaSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _checkpoints->capacity() * sizeof(T) + _deltas->estimate_memory_usage();
+}
+
+template <typename T>
+size_t DeltaSegment<T>::size() const {
+  return _deltas->size();
+}
+
+template <typename T>
+SegmentType DeltaSegment<T>::segment_type() const {
+  return SegmentType::Delta;
+}
+
+template <typename T>
+std::optional<ZoneMap> DeltaSegment<T>::zone_map() const {
+  return _zone_map;
+}
+
+// delta encoding is only supported for the integral types of data_types
+template class DeltaSegment<int32_t>;
+template class DeltaSegment<int64_t>;
+
+}  // namespace opossum
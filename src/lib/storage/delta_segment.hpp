@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// DeltaSegment is an immutable segment type for integral columns whose values are (nearly) in order, such as sequence
+// numbers or timestamps. Every CHECKPOINT_INTERVAL values, the value is stored as is (a checkpoint). All other values
+// are stored as the difference to their predecessor, zig-zag encoded so that small negative differences stay small,
+// in a compressed (bit-packed) attribute vector. Random access decodes at most one block between two checkpoints.
+//
+// If the values are sorted, lower_bound() and upper_bound() find positions by a binary search over the checkpoints,
+// which lets scans answer range predicates without looking at most of the values.
+template <typename T>
+class DeltaSegment : public BaseSegment {
+  static_assert(std::is_integral<T>::value, "DeltaSegment can only be used for integral data types.");
+
+ public:
+  // number of values between two checkpoints, equal to the block size of attribute vectors so that blocks can be
+  // unpacked at once
+  static constexpr ChunkOffset CHECKPOINT_INTERVAL = ATTRIBUTE_VECTOR_BLOCK_SIZE;
+
+  using ValueBlock = std::array<T, CHECKPOINT_INTERVAL>;
+
+  // Creates a DeltaSegment from a given value segment, which has to be encodable (see is_encodable).
+  explicit DeltaSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // Returns whether the zig-zag encoded difference between each pair of neighbouring values of the given value segment
+  // fits into 32 bits. This is always the case for types of up to 32 bits.
+  static bool is_encodable(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a DeltaSegment that takes over the given checkpoints and deltas, e.g., when loading a table
+  DeltaSegment(std::shared_ptr<std::vector<T>> checkpoints, std::shared_ptr<BaseAttributeVector> deltas,
+               const bool is_sorted, std::optional<ZoneMap> zone_map);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position.
+  const T get(const size_t i) const;
+
+  // delta segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // decodes all values of the block that starts at the checkpoint with the given index and returns their number
+  size_t decode_block(const size_t block_index, ValueBlock& values) const;
+
+  // returns whether the values are sorted in ascending order
+  bool is_sorted() const;
+
+  // returns the first position with a value >= the given value, or size() if there is none
+  // only available for sorted segments
+  ChunkOffset lower_bound(const T value) const;
+
+  // returns the first position with a value > the given value, or size() if there is none
+  // only available for sorted segments
+  ChunkOffset upper_bound(const T value) const;
+
+  // returns the value at every CHECKPOINT_INTERVALth position
+  std::shared_ptr<const std::vector<T>> checkpoints() const;
+
+  // returns the zig-zag encoded differences of all values to their predecessors (0 at checkpoints)
+  std::shared_ptr<const BaseAttributeVector> deltas() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  SegmentType segment_type() const override;
+
+  // the zone map is computed when the segment is created
+  std::optional<ZoneMap> zone_map() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _checkpoints;
+  std::shared_ptr<BaseAttributeVector> _deltas;
+  bool _is_sorted;
+  std::optional<ZoneMap> _zone_map;
+
+  ChunkOffset _bound(const T value, const bool is_upper_bound) const;
+};
+
+}  // namespace opossum
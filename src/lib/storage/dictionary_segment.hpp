@@ -2,17 +2,24 @@
 
 #include <type_cast.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
-#include <set>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
 #include "fitted_attribute_vector.hpp"
+#include "front_coded_dictionary.hpp"
 #include "types.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
@@ -22,31 +29,125 @@ class BaseSegment;
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
+// Strings are kept in a compressed FrontCodedDictionary, all other types in a plain sorted vector. Both offer size(),
+// at(), and operator[].
+template <typename T>
+using DictionaryType = std::conditional_t<std::is_same<T, std::string>::value, FrontCodedDictionary, pmr_vector<T>>;
+
+// returns the index of the first dictionary entry >= value (or > value for upper bounds), or the dictionary's size
+template <typename T>
+size_t dictionary_bound(const DictionaryType<T>& dictionary, const T& value, const bool is_upper_bound) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return is_upper_bound ? dictionary.upper_bound(value) : dictionary.lower_bound(value);
+  } else {
+    const auto bound_it = is_upper_bound ? std::upper_bound(dictionary.cbegin(), dictionary.cend(), value)
+                                         : std::lower_bound(dictionary.cbegin(), dictionary.cend(), value);
+    return std::distance(dictionary.cbegin(), bound_it);
+  }
+}
+
+// Returns for each value of the given dictionary the value id of the same value in the target dictionary, which has to
+// contain all of them, e.g., to re-encode a segment with a bigger dictionary.
+template <typename T>
+std::vector<ValueID> map_value_ids(const DictionaryType<T>& dictionary, const DictionaryType<T>& target_dictionary) {
+  auto value_id_mapping = std::vector<ValueID>();
+  value_id_mapping.reserve(dictionary.size());
+  for (size_t value_id = 0; value_id < dictionary.size(); ++value_id) {
+    const auto target_value_id = dictionary_bound<T>(target_dictionary, dictionary[value_id], false);
+    DebugAssert(
+        target_value_id < target_dictionary.size() && target_dictionary[target_value_id] == dictionary[value_id],
+        "value is not in the target dictionary");
+    value_id_mapping.push_back(ValueID{static_cast<uint32_t>(target_value_id)});
+  }
+  return value_id_mapping;
+}
+
+// The part of the interface of DictionarySegments that does not depend on their data type, e.g., for indexes over
+// value ids
+class BaseDictionarySegment : public BaseSegment {
+ public:
+  // returns the first value ID that refers to a value >= the search value, or INVALID_VALUE_ID if there is none
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the first value ID that refers to a value > the search value, or INVALID_VALUE_ID if there is none
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the number of entries of the dictionary
+  virtual size_t unique_values_count() const = 0;
+
+  // returns the value ids of the segment
+  virtual std::shared_ptr<const BaseAttributeVector> attribute_vector() const = 0;
+};
+
 // Dictionary is a specific segment type that stores all its values in a vector
 template <typename T>
-class DictionarySegment : public BaseSegment {
+class DictionarySegment : public BaseDictionarySegment {
  public:
   /**
-   * Creates a Dictionary segment from a given value segment.
+   * Creates a Dictionary segment from a given value segment. The dictionary and the attribute vector are allocated
+   * through the given allocator.
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
-    auto unique_values = std::set<T>();
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                             const PolymorphicAllocator<T>& allocator = {}) {
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+    if (value_segment) {
+      _compress(value_segment->values(), allocator);
+      return;
+    }
 
+    // Other segment types are materialized first, which goes through the slow operator[] unless they are dictionary
+    // encoded already.
+    const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(base_segment);
+    auto values = std::vector<T>();
+    values.reserve(base_segment->size());
     for (size_t value_index = 0; value_index < base_segment->size(); ++value_index) {
-      unique_values.emplace(type_cast<T>(base_segment->operator[](value_index)));
+      values.push_back(dictionary_segment ? dictionary_segment->get(value_index)
+                                          : type_cast<T>(base_segment->operator[](value_index)));
     }
-    _dictionary = std::make_shared<std::vector<T>>(unique_values.cbegin(), unique_values.cend());
-    _attribute_vector =
-        make_shared_attribute_vector(base_segment->size(), ValueID{static_cast<uint32_t>(unique_values.size())});
+    _compress(values, allocator);
+  }
 
-    for (size_t value_index = 0; value_index < base_segment->size(); ++value_index) {
-      const auto value = type_cast<T>(base_segment->operator[](value_index));
-      auto dictionary_it = unique_values.find(value);
-      auto dictionary_index = std::distance(unique_values.cbegin(), dictionary_it);
-      _attribute_vector->set(value_index, ValueID{static_cast<uint32_t>(dictionary_index)});
+  /**
+   * Creates a Dictionary segment with the same values as the given one, but a different dictionary, e.g., one that is
+   * shared by multiple segments. The new dictionary has to contain all values of the given one. value_id_mapping maps
+   * each value id of the given segment to the value id of the same value in the new dictionary.
+   */
+  DictionarySegment(const DictionarySegment<T>& segment, std::shared_ptr<const DictionaryType<T>> dictionary,
+                    const std::vector<ValueID>& value_id_mapping, const PolymorphicAllocator<T>& allocator = {})
+      : _dictionary(dictionary),
+        _min_value_id(value_id_mapping.empty() ? ValueID{0} : value_id_mapping[segment._min_value_id]),
+        _max_value_id(value_id_mapping.empty() ? ValueID{0} : value_id_mapping[segment._max_value_id]) {
+    DebugAssert(value_id_mapping.size() == segment.unique_values_count(), "value id mapping does not fit");
+
+    const auto& attribute_vector = segment.attribute_vector();
+    _attribute_vector = make_shared_compressed_attribute_vector(segment.size(), _max_value_id_for(dictionary->size()),
+                                                                allocator);
+    auto value_ids = ValueIDBlock{};
+    for (size_t block_offset = 0; block_offset < segment.size();) {
+      const auto decoded_count = attribute_vector->decode_block(block_offset, value_ids);
+      for (size_t index = 0; index < decoded_count; ++index) {
+        _attribute_vector->set(block_offset + index, value_id_mapping[value_ids[index]]);
+      }
+      block_offset += decoded_count;
     }
   }
 
+  /**
+   * Creates a Dictionary segment from an existing dictionary and attribute vector, e.g., when loading a table.
+   * min_value_id and max_value_id are the smallest and the biggest value id that occur in the attribute vector.
+   */
+  DictionarySegment(std::shared_ptr<const DictionaryType<T>> dictionary,
+                    std::shared_ptr<BaseAttributeVector> attribute_vector, const ValueID min_value_id,
+                    const ValueID max_value_id)
+      : _dictionary(dictionary),
+        _attribute_vector(attribute_vector),
+        _min_value_id(min_value_id),
+        _max_value_id(max_value_id) {
+    Assert(_attribute_vector->size() == 0 ||
+               (_min_value_id <= _max_value_id && _max_value_id < _dictionary->size()),
+           "value ids are not in the dictionary");
+  }
+
   // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
   // the DictionarySegment in this file. Replace the method signatures with actual implementations.
 
@@ -62,50 +163,122 @@ class DictionarySegment : public BaseSegment {
   // dictionary segments are immutable
   void append(const AllTypeVariant&) override { Fail("can not append value to DictionarySegment"); }
 
+  // the smallest and the biggest value are found in the dictionary, which might be shared with other segments
+  std::optional<ZoneMap> zone_map() const override {
+    if (size() == 0) return std::nullopt;
+    return ZoneMap{(*_dictionary)[_min_value_id], (*_dictionary)[_max_value_id]};
+  }
+
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
+  std::shared_ptr<const DictionaryType<T>> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override { return _attribute_vector; }
+
+  // return the smallest and the biggest value id that occur in the segment
+  ValueID min_value_id() const { return _min_value_id; }
+  ValueID max_value_id() const { return _max_value_id; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
+  const T value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
   ValueID lower_bound(T value) const {
-    const auto lower_bound_it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-    if (lower_bound_it == _dictionary->cend()) {
+    const auto lower_bound_index = dictionary_bound<T>(*_dictionary, value, false);
+    if (lower_bound_index == _dictionary->size()) {
       return INVALID_VALUE_ID;
     }
-    return ValueID(static_cast<uint32_t>(std::distance(_dictionary->cbegin(), lower_bound_it)));
+    return ValueID(static_cast<uint32_t>(lower_bound_index));
   }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const { return lower_bound(type_cast<T>(value)); }
+  ValueID lower_bound(const AllTypeVariant& value) const override { return lower_bound(type_cast<T>(value)); }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
   ValueID upper_bound(T value) const {
-    const auto upper_bound_it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-    if (upper_bound_it == _dictionary->cend()) {
+    const auto upper_bound_index = dictionary_bound<T>(*_dictionary, value, true);
+    if (upper_bound_index == _dictionary->size()) {
       return INVALID_VALUE_ID;
     }
-    return ValueID(static_cast<uint32_t>(std::distance(_dictionary->cbegin(), upper_bound_it)));
+    return ValueID(static_cast<uint32_t>(upper_bound_index));
   }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(type_cast<T>(value)); }
+  ValueID upper_bound(const AllTypeVariant& value) const override { return upper_bound(type_cast<T>(value)); }
 
-  // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const { return _dictionary->size(); }
+  // return the number of unique_values (dictionary entries, which include values of other segments if the dictionary
+  // is shared)
+  size_t unique_values_count() const override { return _dictionary->size(); }
 
   // return the number of entries
   size_t size() const override { return _attribute_vector->size(); };
 
+  SegmentType segment_type() const override { return SegmentType::Dictionary; }
+
+  size_t estimate_memory_usage() const override {
+    auto dictionary_memory_usage = size_t{0};
+    if constexpr (std::is_same<T, std::string>::value) {
+      dictionary_memory_usage = _dictionary->estimate_memory_usage();
+    } else {
+      dictionary_memory_usage = sizeof(*_dictionary) + estimate_values_memory_usage(*_dictionary);
+    }
+    return sizeof(*this) + dictionary_memory_usage + _attribute_vector->estimate_memory_usage();
+  }
+
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  std::shared_ptr<const DictionaryType<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
+  ValueID _min_value_id{0};
+  ValueID _max_value_id{0};
+
+  // values is either a std::vector<T> or the ValueVector<T> of a ValueSegment
+  template <typename Values>
+  void _compress(const Values& values, const PolymorphicAllocator<T>& allocator) {
+    if constexpr (std::is_same<T, std::string>::value) {
+      // Sorting views instead of strings avoids copying every string. The value ids are then looked up by hash, as
+      // comparing strings during a binary search is comparatively expensive.
+      auto unique_values = std::vector<std::string_view>();
+      auto value_ids = std::unordered_map<std::string_view, ValueID>();
+      for (const auto& value : values) {
+        if (value_ids.emplace(value, ValueID{0}).second) unique_values.push_back(value);
+      }
+      std::sort(unique_values.begin(), unique_values.end());
+      for (size_t dictionary_index = 0; dictionary_index < unique_values.size(); ++dictionary_index) {
+        value_ids[unique_values[dictionary_index]] = ValueID{static_cast<uint32_t>(dictionary_index)};
+      }
+
+      _dictionary = std::make_shared<DictionaryType<T>>(unique_values.cbegin(), unique_values.cend(), allocator);
+      _attribute_vector =
+          make_shared_compressed_attribute_vector(values.size(), _max_value_id_for(unique_values.size()), allocator);
+      for (size_t value_index = 0; value_index < values.size(); ++value_index) {
+        _attribute_vector->set(value_index, value_ids.find(values[value_index])->second);
+      }
+    } else {
+      // The values are sorted in a temporary vector, so that only the final dictionary is allocated through the given
+      // allocator. This matters for arenas, which do not reuse freed memory.
+      auto unique_values = std::vector<T>(values.cbegin(), values.cend());
+      std::sort(unique_values.begin(), unique_values.end());
+      unique_values.erase(std::unique(unique_values.begin(), unique_values.end()), unique_values.end());
+
+      _attribute_vector =
+          make_shared_compressed_attribute_vector(values.size(), _max_value_id_for(unique_values.size()), allocator);
+      for (size_t value_index = 0; value_index < values.size(); ++value_index) {
+        const auto dictionary_it = std::lower_bound(unique_values.cbegin(), unique_values.cend(), values[value_index]);
+        const auto dictionary_index = std::distance(unique_values.cbegin(), dictionary_it);
+        _attribute_vector->set(value_index, ValueID{static_cast<uint32_t>(dictionary_index)});
+      }
+      _dictionary = std::make_shared<DictionaryType<T>>(unique_values.cbegin(), unique_values.cend(), allocator);
+    }
+
+    _max_value_id = _max_value_id_for(_dictionary->size());
+  }
+
+  // The attribute vector only needs to hold the biggest value id, which is one less than the number of unique values
+  static ValueID _max_value_id_for(const size_t unique_values_count) {
+    return ValueID{static_cast<uint32_t>(std::max(unique_values_count, size_t{1}) - 1)};
+  }
 };
 
 }  // namespace opossum
@@ -1,16 +1,23 @@
 #include "fitted_attribute_vector.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <utility>
 
 namespace opossum {
 
 template <typename T>
-FittedAttributeVector<T>::FittedAttributeVector(const size_t size, const ValueID max_value) : _values(size) {
+FittedAttributeVector<T>::FittedAttributeVector(const size_t size, const ValueID max_value,
+                                                const PolymorphicAllocator<T>& allocator)
+    : _values(size, allocator) {
   Assert(ValueID{static_cast<uint32_t>(std::numeric_limits<T>::max())} >= max_value,
          "too many unique values for VariableAttributeVector");
 }
 
+template <typename T>
+FittedAttributeVector<T>::FittedAttributeVector(pmr_vector<T>&& values) : _values(std::move(values)) {}
+
 template <typename T>
 ValueID FittedAttributeVector<T>::get(const size_t i) const {
   return ValueID(static_cast<uint32_t>(_values.at(i)));
@@ -28,22 +35,46 @@ size_t FittedAttributeVector<T>::size() const {
   return _values.size();
 }
 
+template <typename T>
+size_t FittedAttributeVector<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _values.capacity() * sizeof(T);
+}
+
 template <typename T>
 AttributeVectorWidth FittedAttributeVector<T>::width() const {
   return static_cast<AttributeVectorWidth>(std::numeric_limits<T>::digits / 8);
 }
 
-std::shared_ptr<BaseAttributeVector> make_shared_attribute_vector(const size_t size, const ValueID max_value) {
+template <typename T>
+size_t FittedAttributeVector<T>::decode_block(const size_t offset, ValueIDBlock& out) const {
+  const auto count = std::min(ATTRIBUTE_VECTOR_BLOCK_SIZE, _values.size() - offset);
+  for (size_t index = 0; index < count; ++index) {
+    out[index] = ValueID{static_cast<uint32_t>(_values[offset + index])};
+  }
+  return count;
+}
+
+template <typename T>
+const pmr_vector<T>& FittedAttributeVector<T>::values() const {
+  return _values;
+}
+
+std::shared_ptr<BaseAttributeVector> make_shared_attribute_vector(const size_t size, const ValueID max_value,
+                                                                  const PolymorphicAllocator<size_t>& allocator) {
   Assert(ValueID{static_cast<uint32_t>(std::numeric_limits<uint32_t>::max())} >= max_value,
          "too many unique values for AttributeVector");
 
   if (ValueID{static_cast<uint32_t>(std::numeric_limits<uint8_t>::max())} >= max_value) {
-    return std::make_shared<FittedAttributeVector<uint8_t>>(size, max_value);
+    return std::make_shared<FittedAttributeVector<uint8_t>>(size, max_value, allocator);
   } else if (ValueID{static_cast<uint32_t>(std::numeric_limits<uint16_t>::max())} >= max_value) {
-    return std::make_shared<FittedAttributeVector<uint16_t>>(size, max_value);
+    return std::make_shared<FittedAttributeVector<uint16_t>>(size, max_value, allocator);
   }
 
-  return std::make_shared<FittedAttributeVector<uint32_t>>(size, max_value);
+  return std::make_shared<FittedAttributeVector<uint32_t>>(size, max_value, allocator);
 }
 
+template class FittedAttributeVector<uint8_t>;
+template class FittedAttributeVector<uint16_t>;
+template class FittedAttributeVector<uint32_t>;
+
 }  // namespace opossum
@@ -19,7 +19,10 @@ class FittedAttributeVector : public BaseAttributeVector {
                 "VariableAttributeVector can only be instantiated using an unsigned data type (such as uint8_t).");
 
  public:
-  explicit FittedAttributeVector(const size_t size, const ValueID max_value);
+  FittedAttributeVector(const size_t size, const ValueID max_value, const PolymorphicAllocator<T>& allocator = {});
+
+  // creates an attribute vector that takes over the given value ids, e.g., when loading a table
+  explicit FittedAttributeVector(pmr_vector<T>&& values);
 
   ValueID get(const size_t i) const override;
 
@@ -29,10 +32,19 @@ class FittedAttributeVector : public BaseAttributeVector {
 
   AttributeVectorWidth width() const override;
 
+  size_t estimate_memory_usage() const override;
+
+  size_t decode_block(const size_t offset, ValueIDBlock& out) const override;
+
+  // returns the underlying value ids, e.g., to write them to a file
+  const pmr_vector<T>& values() const;
+
  protected:
-  std::vector<T> _values;
+  pmr_vector<T> _values;
 };
 
-std::shared_ptr<BaseAttributeVector> make_shared_attribute_vector(const size_t size, const ValueID max_value);
+// creates a FittedAttributeVector of the smallest width that fits max_value
+std::shared_ptr<BaseAttributeVector> make_shared_attribute_vector(const size_t size, const ValueID max_value,
+                                                                  const PolymorphicAllocator<size_t>& allocator = {});
 
 }  // namespace opossum
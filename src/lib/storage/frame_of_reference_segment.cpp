@@ -0,0 +1,153 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _block_minima(std::make_shared<std::vector<T>>()), _max_offset(0) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment != nullptr, "FrameOfReferenceSegment can only be created from a ValueSegment of the same type");
+
+  const auto& values = value_segment->values();
+  const auto block_count = (values.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minima->reserve(block_count);
+  auto min_value = std::numeric_limits<T>::max();
+  auto max_value = std::numeric_limits<T>::min();
+
+  // The first pass determines the minimum of each block and the biggest offset, which defines the width of the
+  // attribute vector. The subtraction is done on unsigned values so that it cannot overflow.
+  for (size_t block_index = 0; block_index < block_count; ++block_index) {
+    const auto block_begin = values.cbegin() + block_index * BLOCK_SIZE;
+    const auto block_end = values.cbegin() + std::min(values.size(), (block_index + 1) * BLOCK_SIZE);
+    const auto [min_it, max_it] = std::minmax_element(block_begin, block_end);
+
+    const auto block_range = static_cast<UnsignedT>(static_cast<UnsignedT>(*max_it) - static_cast<UnsignedT>(*min_it));
+    Assert(block_range <= std::numeric_limits<uint32_t>::max(),
+           "value range of a block is too large for FrameOfReferenceSegment");
+
+    _block_minima->push_back(*min_it);
+    _max_offset = std::max(_max_offset, static_cast<uint32_t>(block_range));
+    min_value = std::min(min_value, *min_it);
+    max_value = std::max(max_value, *max_it);
+  }
+
+  if (!values.empty()) _zone_map = ZoneMap{min_value, max_value};
+
+  _offsets = make_shared_compressed_attribute_vector(values.size(), ValueID{_max_offset});
+  for (size_t value_index = 0; value_index < values.size(); ++value_index) {
+    const auto block_minimum = (*_block_minima)[value_index / BLOCK_SIZE];
+    const auto offset = static_cast<UnsignedT>(values[value_index]) - static_cast<UnsignedT>(block_minimum);
+    _offsets->set(value_index, ValueID{static_cast<uint32_t>(offset)});
+  }
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_encodable(const std::shared_ptr<BaseSegment>& base_segment) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  if constexpr (sizeof(T) <= sizeof(uint32_t)) {
+    return true;
+  } else {
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+    Assert(value_segment != nullptr,
+           "FrameOfReferenceSegment can only be created from a ValueSegment of the same type");
+
+    const auto& values = value_segment->values();
+    for (size_t block_begin = 0; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+      const auto block_end = std::min(values.size(), block_begin + BLOCK_SIZE);
+      const auto [min_it, max_it] = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+      const auto block_range = static_cast<UnsignedT>(*max_it) - static_cast<UnsignedT>(*min_it);
+      if (block_range > std::numeric_limits<uint32_t>::max()) return false;
+    }
+    return true;
+  }
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(std::shared_ptr<std::vector<T>> block_minima,
+                                                    std::shared_ptr<BaseAttributeVector> offsets,
+                                                    const uint32_t max_offset, std::optional<ZoneMap> zone_map)
+    : _block_minima(std::move(block_minima)),
+      _offsets(std::move(offsets)),
+      _max_offset(max_offset),
+      _zone_map(std::move(zone_map)) {
+  DebugAssert(_block_minima->size() == (_offsets->size() + BLOCK_SIZE - 1) / BLOCK_SIZE,
+              "each block needs a minimum");
+}
+
+template <typename T>
+const AllTypeVariant FrameOfReferenceSegment<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  return get(i);
+}
+
+template <typename T>
+const T FrameOfReferenceSegment<T>::get(const size_t i) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto block_minimum = static_cast<UnsignedT>((*_block_minima)[i / BLOCK_SIZE]);
+  return static_cast<T>(block_minimum + static_cast<UnsignedT>(_offsets->get(i)));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant&) {
+  Fail("can not append value to FrameOfReferenceSegment");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+std::shared_ptr<const BaseAttributeVector> FrameOfReferenceSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+uint32_t FrameOfReferenceSegment<T>::max_offset() const {
+  return _max_offset;
+}
+
+template <typename T>
+std::optional<ZoneMap> FrameOfReferenceSegment<T>::zone_map() const {
+  return _zone_map;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _block_minima->capacity() * sizeof(T) + _offsets->estimate_memory_usage();
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::size() const {
+  return _offsets->size();
+}
+
+template <typename T>
+SegmentType FrameOfReferenceSegment<T>::segment_type() const {
+  return SegmentType::FrameOfReference;
+}
+
+// frame-of-reference encoding is only supported for the integral types of data_types
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
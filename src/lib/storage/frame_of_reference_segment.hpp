@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// FrameOfReferenceSegment is an immutable segment type for integral columns. The segment is divided into blocks of
+// BLOCK_SIZE values. For each block, the minimum value is stored. Each value is stored as its offset to the minimum of
+// its block. The offsets are held in a compressed (bit-packed) attribute vector, so a column with a narrow value
+// range per block needs only a few bits per value, even if all of its values are distinct.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(std::is_integral<T>::value, "FrameOfReferenceSegment can only be used for integral data types.");
+
+ public:
+  // number of values that share a minimum, a multiple of ATTRIBUTE_VECTOR_BLOCK_SIZE
+  static constexpr ChunkOffset BLOCK_SIZE = 2048;
+
+  // Creates a FrameOfReferenceSegment from a given value segment, which has to be encodable (see is_encodable).
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // Returns whether the value range of each block of the given value segment fits into the 32 bit offsets. This is
+  // always the case for types of up to 32 bits.
+  static bool is_encodable(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a FrameOfReferenceSegment that takes over the given blocks, e.g., when loading a table
+  FrameOfReferenceSegment(std::shared_ptr<std::vector<T>> block_minima, std::shared_ptr<BaseAttributeVector> offsets,
+                          const uint32_t max_offset, std::optional<ZoneMap> zone_map);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position.
+  const T get(const size_t i) const;
+
+  // frame-of-reference segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns the minimum of each block
+  std::shared_ptr<const std::vector<T>> block_minima() const;
+
+  // returns the offsets of all values to the minimum of their block
+  std::shared_ptr<const BaseAttributeVector> offsets() const;
+
+  // returns the biggest offset of any value
+  uint32_t max_offset() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  SegmentType segment_type() const override;
+
+  // the zone map is computed when the segment is created
+  std::optional<ZoneMap> zone_map() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _block_minima;
+  std::shared_ptr<BaseAttributeVector> _offsets;
+  uint32_t _max_offset;
+  std::optional<ZoneMap> _zone_map;
+};
+
+}  // namespace opossum
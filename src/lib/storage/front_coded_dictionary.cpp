@@ -0,0 +1,142 @@
+#include "front_coded_dictionary.hpp"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+FrontCodedDictionary::FrontCodedDictionary(pmr_vector<char>&& data, pmr_vector<size_t>&& block_offsets,
+                                           const size_t size)
+    : _data(std::move(data)), _block_offsets(std::move(block_offsets)), _size(size) {
+  Assert(_block_offsets.size() == (_size + BLOCK_SIZE - 1) / BLOCK_SIZE, "block offsets do not match the size");
+  Assert(std::all_of(_block_offsets.cbegin(), _block_offsets.cend(),
+                     [&](const size_t block_offset) { return block_offset < _data.size(); }),
+         "block offsets are out of range");
+}
+
+void FrontCodedDictionary::_append(const std::string_view value, const std::string_view previous_value) {
+  DebugAssert(_size == 0 || previous_value < value, "values of a FrontCodedDictionary must be sorted and distinct");
+
+  if (_size % BLOCK_SIZE == 0) {
+    // block heads are stored without a shared prefix
+    _block_offsets.push_back(_data.size());
+    _write_length(value.size());
+    _data.insert(_data.end(), value.cbegin(), value.cend());
+  } else {
+    const auto mismatch = std::mismatch(previous_value.cbegin(), previous_value.cend(), value.cbegin(), value.cend());
+    const auto prefix_length = static_cast<size_t>(std::distance(value.cbegin(), mismatch.second));
+    _write_length(prefix_length);
+    _write_length(value.size() - prefix_length);
+    _data.insert(_data.end(), mismatch.second, value.cend());
+  }
+
+  ++_size;
+}
+
+void FrontCodedDictionary::_write_length(const size_t length) {
+  auto remaining_length = length;
+  while (remaining_length >= 0x80) {
+    _data.push_back(static_cast<char>((remaining_length & 0x7F) | 0x80));
+    remaining_length >>= 7;
+  }
+  _data.push_back(static_cast<char>(remaining_length));
+}
+
+size_t FrontCodedDictionary::_read_length(size_t& position) const {
+  auto length = size_t{0};
+  auto shift = size_t{0};
+  auto byte = uint8_t{0};
+  do {
+    byte = static_cast<uint8_t>(_data[position++]);
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return length;
+}
+
+std::string_view FrontCodedDictionary::_block_head(const size_t block_index) const {
+  auto position = _block_offsets[block_index];
+  const auto length = _read_length(position);
+  return std::string_view{_data.data() + position, length};
+}
+
+void FrontCodedDictionary::_read_next(size_t& position, std::string& value) const {
+  const auto prefix_length = _read_length(position);
+  const auto suffix_length = _read_length(position);
+  value.resize(prefix_length);
+  value.append(_data.data() + position, suffix_length);
+  position += suffix_length;
+}
+
+std::string FrontCodedDictionary::operator[](const size_t index) const {
+  DebugAssert(index < _size, "index out of range");
+
+  const auto block_index = index / BLOCK_SIZE;
+  auto position = _block_offsets[block_index];
+  const auto head_length = _read_length(position);
+  auto value = std::string{_data.data() + position, head_length};
+  position += head_length;
+
+  for (auto current_index = block_index * BLOCK_SIZE; current_index < index; ++current_index) {
+    _read_next(position, value);
+  }
+  return value;
+}
+
+std::string FrontCodedDictionary::at(const size_t index) const {
+  Assert(index < _size, "index out of range");
+  return (*this)[index];
+}
+
+size_t FrontCodedDictionary::lower_bound(const std::string& value) const { return _bound(value, false); }
+
+size_t FrontCodedDictionary::upper_bound(const std::string& value) const { return _bound(value, true); }
+
+size_t FrontCodedDictionary::_bound(const std::string& value, const bool is_upper_bound) const {
+  const auto matches = [&](const std::string_view entry) { return is_upper_bound ? entry > value : entry >= value; };
+
+  // Find the first block whose head matches. As the strings are sorted, the result is either that block's head or
+  // one of the strings of the previous block.
+  auto first_block = size_t{0};
+  auto block_count = _block_offsets.size();
+  while (block_count > 0) {
+    const auto step = block_count / 2;
+    if (!matches(_block_head(first_block + step))) {
+      first_block += step + 1;
+      block_count -= step + 1;
+    } else {
+      block_count = step;
+    }
+  }
+
+  if (first_block == 0) return 0;
+
+  // The head of the previous block does not match, so it is skipped and the remaining strings are decoded in order.
+  const auto block_index = first_block - 1;
+  const auto block_end = std::min(_size, first_block * BLOCK_SIZE);
+  auto position = _block_offsets[block_index];
+  const auto head_length = _read_length(position);
+  auto entry = std::string{_data.data() + position, head_length};
+  position += head_length;
+
+  for (auto index = block_index * BLOCK_SIZE + 1; index < block_end; ++index) {
+    _read_next(position, entry);
+    if (matches(entry)) return index;
+  }
+  return block_end;
+}
+
+size_t FrontCodedDictionary::size() const { return _size; }
+
+size_t FrontCodedDictionary::data_size() const { return _data.size(); }
+
+size_t FrontCodedDictionary::estimate_memory_usage() const {
+  return sizeof(*this) + _data.capacity() + _block_offsets.capacity() * sizeof(size_t);
+}
+
+}  // namespace opossum
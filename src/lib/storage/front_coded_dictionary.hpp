@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// FrontCodedDictionary is an immutable, sorted dictionary of strings that is stored in a single contiguous buffer.
+// The strings are grouped into blocks of BLOCK_SIZE strings. The first string of each block (the block head) is
+// stored as is. Every other string is stored as the length of the prefix it shares with its predecessor, followed by
+// the remaining suffix. All lengths are variable-length encoded (7 bits per byte).
+//
+// As strings in sorted dictionaries usually share long prefixes with their neighbours (think of URLs), this avoids
+// both the std::string object and the separate heap allocation per entry. Random access decodes at most one block.
+// Searches use a binary search over the block heads, which can be compared without decoding, and decode only one
+// block.
+class FrontCodedDictionary : private Noncopyable {
+ public:
+  static constexpr size_t BLOCK_SIZE = 16;
+
+  // creates the dictionary from a range of sorted, distinct strings (or string_views)
+  template <typename Iterator>
+  FrontCodedDictionary(Iterator begin, Iterator end, const PolymorphicAllocator<char>& allocator = {});
+
+  // creates the dictionary from the buffers of another one, e.g., when loading a table
+  FrontCodedDictionary(pmr_vector<char>&& data, pmr_vector<size_t>&& block_offsets, const size_t size);
+
+  // returns the string at the given index
+  std::string operator[](const size_t index) const;
+
+  // same as operator[], but checks the index
+  std::string at(const size_t index) const;
+
+  // returns the index of the first string >= value, or size() if there is none
+  size_t lower_bound(const std::string& value) const;
+
+  // returns the index of the first string > value, or size() if there is none
+  size_t upper_bound(const std::string& value) const;
+
+  // returns the number of strings
+  size_t size() const;
+
+  // returns the size of the buffer holding all strings in bytes
+  size_t data_size() const;
+
+  // returns the number of bytes used by the dictionary
+  size_t estimate_memory_usage() const;
+
+  // return the underlying buffers, e.g., to write them to a file
+  const pmr_vector<char>& data() const { return _data; }
+  const pmr_vector<size_t>& block_offsets() const { return _block_offsets; }
+
+ protected:
+  pmr_vector<char> _data;
+  pmr_vector<size_t> _block_offsets;
+  size_t _size = 0;
+
+  void _append(const std::string_view value, const std::string_view previous_value);
+  void _write_length(const size_t length);
+  size_t _read_length(size_t& position) const;
+  std::string_view _block_head(const size_t block_index) const;
+  void _read_next(size_t& position, std::string& value) const;
+  size_t _bound(const std::string& value, const bool is_upper_bound) const;
+};
+
+template <typename Iterator>
+FrontCodedDictionary::FrontCodedDictionary(Iterator begin, Iterator end, const PolymorphicAllocator<char>& allocator)
+    : _data(allocator), _block_offsets(allocator) {
+  auto previous_value = std::string_view{};
+  for (auto it = begin; it != end; ++it) {
+    const auto value = std::string_view{*it};
+    _append(value, previous_value);
+    previous_value = value;
+  }
+
+  _data.shrink_to_fit();
+  _block_offsets.shrink_to_fit();
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "dictionary_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& indexed_segments)
+    : BaseIndex(SegmentIndexType::GroupKey) {
+  Assert(indexed_segments.size() == 1, "GroupKeyIndex only works with a single segment");
+  Assert(indexed_segments.front()->segment_type() == SegmentType::Dictionary,
+         "GroupKeyIndex only works with DictionarySegments");
+  _indexed_segment = std::static_pointer_cast<const BaseDictionarySegment>(indexed_segments.front());
+
+  const auto& attribute_vector = *_indexed_segment->attribute_vector();
+  const auto size = attribute_vector.size();
+
+  // The postings are filled by a counting sort: the rows per value id are counted first, their prefix sums are the
+  // offsets. The attribute vector is decoded block by block in both passes.
+  auto value_ids = ValueIDBlock{};
+  _offsets.assign(_indexed_segment->unique_values_count() + 1, ChunkOffset{0});
+  for (size_t block_offset = 0; block_offset < size;) {
+    const auto decoded_count = attribute_vector.decode_block(block_offset, value_ids);
+    for (size_t index = 0; index < decoded_count; ++index) ++_offsets[value_ids[index] + 1];
+    block_offset += decoded_count;
+  }
+  std::partial_sum(_offsets.cbegin(), _offsets.cend(), _offsets.begin());
+
+  // the next free slot in the postings per value id, rows are visited in ascending order
+  auto next_postings = std::vector<ChunkOffset>(_offsets.cbegin(), _offsets.cend() - 1);
+  _postings.resize(size);
+  for (size_t block_offset = 0; block_offset < size;) {
+    const auto decoded_count = attribute_vector.decode_block(block_offset, value_ids);
+    for (size_t index = 0; index < decoded_count; ++index) {
+      _postings[next_postings[value_ids[index]]++] = ChunkOffset(block_offset + index);
+    }
+    block_offset += decoded_count;
+  }
+}
+
+size_t GroupKeyIndex::estimate_memory_usage() const {
+  return sizeof(*this) + (_offsets.capacity() + _postings.capacity()) * sizeof(ChunkOffset);
+}
+
+BaseIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _postings_begin(_indexed_segment->lower_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _postings_begin(_indexed_segment->upper_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cbegin() const { return _postings.cbegin(); }
+
+BaseIndex::Iterator GroupKeyIndex::_cend() const { return _postings.cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> GroupKeyIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+BaseIndex::Iterator GroupKeyIndex::_postings_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _postings.cend();
+  return _postings.cbegin() + _offsets[value_id];
+}
+
+}  // namespace opossum
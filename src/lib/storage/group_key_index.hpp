@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+class BaseSegment;
+
+// A GroupKeyIndex on a single DictionarySegment. It groups the positions of the segment by their value ids:
+//
+//   postings: the positions of all rows, ordered by value id and then by position
+//   offsets:  for each value id, the index of its first position in postings, followed by the number of rows
+//
+// The positions of the rows with value id v are postings[offsets[v]] to postings[offsets[v + 1] - 1]. As value ids
+// are ordered like their values, the search values only need to be turned into value ids by the dictionary.
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& indexed_segments);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const override;
+
+  // returns an iterator to the first position of the given value id (INVALID_VALUE_ID stands for the end)
+  Iterator _postings_begin(const ValueID value_id) const;
+
+  std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+  std::vector<ChunkOffset> _offsets;
+  std::vector<ChunkOffset> _postings;
+};
+
+}  // namespace opossum
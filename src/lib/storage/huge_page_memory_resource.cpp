@@ -0,0 +1,89 @@
+#include "huge_page_memory_resource.hpp"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+size_t round_up_to_huge_pages(const size_t bytes) {
+  return (bytes + HugePageMemoryResource::HUGE_PAGE_SIZE - 1) / HugePageMemoryResource::HUGE_PAGE_SIZE *
+         HugePageMemoryResource::HUGE_PAGE_SIZE;
+}
+
+}  // namespace
+
+HugePageMemoryResource::HugePageMemoryResource(const size_t min_huge_page_allocation,
+                                               std::pmr::memory_resource* upstream)
+    : _min_huge_page_allocation(min_huge_page_allocation), _upstream(upstream) {
+  DebugAssert(upstream, "an upstream resource is needed");
+}
+
+size_t HugePageMemoryResource::min_huge_page_allocation() const { return _min_huge_page_allocation; }
+
+std::pmr::memory_resource* HugePageMemoryResource::upstream() const { return _upstream; }
+
+size_t HugePageMemoryResource::huge_page_allocation_count() const { return _huge_page_allocation_count; }
+
+size_t HugePageMemoryResource::fallback_allocation_count() const { return _fallback_allocation_count; }
+
+void* HugePageMemoryResource::do_allocate(const size_t bytes, const size_t alignment) {
+  if (!_is_huge_page_allocation(bytes, alignment)) return _upstream->allocate(bytes, alignment);
+
+  const auto size = round_up_to_huge_pages(bytes);
+  auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (data != MAP_FAILED) {
+    ++_huge_page_allocation_count;
+    return data;
+  }
+
+  // No huge pages are reserved. The kernel can only back 2 MB aligned ranges with transparent huge pages, so one more
+  // huge page is mapped and the unaligned parts are unmapped again.
+  const auto mapped_size = size + HUGE_PAGE_SIZE;
+  data = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) throw std::bad_alloc{};
+
+  const auto address = reinterpret_cast<uintptr_t>(data);
+  const auto aligned_address = (address + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+  if (aligned_address > address) munmap(data, aligned_address - address);
+  if (aligned_address + size < address + mapped_size) {
+    munmap(reinterpret_cast<void*>(aligned_address + size), address + mapped_size - (aligned_address + size));
+  }
+
+  // the advice is only a hint, the memory can be used either way
+  data = reinterpret_cast<void*>(aligned_address);
+  madvise(data, size, MADV_HUGEPAGE);
+  ++_fallback_allocation_count;
+  return data;
+}
+
+void HugePageMemoryResource::do_deallocate(void* pointer, const size_t bytes, const size_t alignment) {
+  if (!_is_huge_page_allocation(bytes, alignment)) {
+    _upstream->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+  // both kinds of huge page allocations are mappings of the rounded size
+  munmap(pointer, round_up_to_huge_pages(bytes));
+}
+
+bool HugePageMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+bool HugePageMemoryResource::_is_huge_page_allocation(const size_t bytes, const size_t alignment) const {
+  return bytes >= _min_huge_page_allocation && bytes > 0 && alignment <= HUGE_PAGE_SIZE;
+}
+
+HugePageMemoryResource* huge_page_memory_resource() {
+  static auto memory_resource = HugePageMemoryResource{};
+  return &memory_resource;
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A memory resource that backs large allocations with 2 MB huge pages, so that scans over large segments need fewer
+// TLB entries. Allocations of at least min_huge_page_allocation bytes are mapped with MAP_HUGETLB. If no huge pages are
+// reserved in the system (see /proc/sys/vm/nr_hugepages), they are mapped with regular pages instead, aligned to 2 MB
+// and marked with MADV_HUGEPAGE, so that transparent huge pages can back them. Smaller allocations are passed to the
+// upstream resource.
+//
+// The resource is thread-safe if the upstream resource is. Pass it to a Table to use it for that table's segments, or
+// make it the default resource (std::pmr::set_default_resource(huge_page_memory_resource())) to use it for all tables
+// created afterwards.
+class HugePageMemoryResource : public std::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr size_t HUGE_PAGE_SIZE = size_t{2} * 1024 * 1024;
+
+  explicit HugePageMemoryResource(size_t min_huge_page_allocation = HUGE_PAGE_SIZE,
+                                  std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+  size_t min_huge_page_allocation() const;
+
+  std::pmr::memory_resource* upstream() const;
+
+  // returns the number of allocations so far that have been backed by explicit (MAP_HUGETLB) huge pages
+  size_t huge_page_allocation_count() const;
+
+  // returns the number of allocations so far that have been mapped with the transparent huge page fallback
+  size_t fallback_allocation_count() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  bool _is_huge_page_allocation(size_t bytes, size_t alignment) const;
+
+  const size_t _min_huge_page_allocation;
+  std::pmr::memory_resource* const _upstream;
+
+  std::atomic<size_t> _huge_page_allocation_count{0};
+  std::atomic<size_t> _fallback_allocation_count{0};
+};
+
+// returns a process-wide HugePageMemoryResource with the default settings
+HugePageMemoryResource* huge_page_memory_resource();
+
+}  // namespace opossum
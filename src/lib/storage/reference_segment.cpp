@@ -22,6 +22,12 @@ const AllTypeVariant ReferenceSegment::operator[](const size_t i) const {
 
 size_t ReferenceSegment::size() const { return _pos_list->size(); }
 
+SegmentType ReferenceSegment::segment_type() const { return SegmentType::Reference; }
+
+size_t ReferenceSegment::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(PosList) + _pos_list->capacity() * sizeof(RowID);
+}
+
 const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
 
 const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
@@ -30,6 +30,10 @@ class ReferenceSegment : public BaseSegment {
 
   size_t size() const override;
 
+  SegmentType segment_type() const override;
+
+  size_t estimate_memory_usage() const override;
+
   const std::shared_ptr<const PosList> pos_list() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
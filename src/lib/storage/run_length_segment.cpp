@@ -0,0 +1,112 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _values(std::make_shared<std::vector<T>>()), _end_positions(std::make_shared<std::vector<ChunkOffset>>()) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  Assert(value_segment != nullptr, "RunLengthSegment can only be created from a ValueSegment of the same type");
+
+  const auto& values = value_segment->values();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    // a new run starts whenever the value differs from the one of the current run
+    if (_values->empty() || values[chunk_offset] != _values->back()) {
+      _values->emplace_back(values[chunk_offset]);
+      _end_positions->push_back(chunk_offset);
+    } else {
+      _end_positions->back() = chunk_offset;
+    }
+  }
+
+  _values->shrink_to_fit();
+  _end_positions->shrink_to_fit();
+
+  if (!_values->empty()) {
+    const auto [min_it, max_it] = std::minmax_element(_values->cbegin(), _values->cend());
+    _zone_map = ZoneMap{*min_it, *max_it};
+  }
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(std::shared_ptr<std::vector<T>> values,
+                                      std::shared_ptr<std::vector<ChunkOffset>> end_positions)
+    : _values(std::move(values)), _end_positions(std::move(end_positions)) {
+  DebugAssert(_values->size() == _end_positions->size(), "each run needs a value and an end position");
+  if (!_values->empty()) {
+    const auto [min_it, max_it] = std::minmax_element(_values->cbegin(), _values->cend());
+    _zone_map = ZoneMap{*min_it, *max_it};
+  }
+}
+
+template <typename T>
+const AllTypeVariant RunLengthSegment<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  return get(i);
+}
+
+template <typename T>
+const T RunLengthSegment<T>::get(const size_t i) const {
+  DebugAssert(i < size(), "index out of range");
+
+  // the run containing i is the first one that ends at or behind i
+  const auto end_position_it = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), i);
+  return (*_values)[std::distance(_end_positions->cbegin(), end_position_it)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant&) {
+  Fail("can not append value to RunLengthSegment");
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<ChunkOffset>> RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values->size();
+}
+
+template <typename T>
+std::optional<ZoneMap> RunLengthSegment<T>::zone_map() const {
+  return _zone_map;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + estimate_values_memory_usage(*_values) +
+         _end_positions->capacity() * sizeof(ChunkOffset);
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::size() const {
+  return _end_positions->empty() ? 0 : _end_positions->back() + 1;
+}
+
+template <typename T>
+SegmentType RunLengthSegment<T>::segment_type() const {
+  return SegmentType::RunLength;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
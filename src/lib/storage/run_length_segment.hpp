@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// RunLengthSegment is an immutable segment type that replaces each run of equal values by a single value and the
+// position of the run's last element. It is well suited for sorted or low-cardinality columns with long runs.
+// Scans can evaluate a predicate once per run instead of once per row.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // Creates a RunLengthSegment from a given value segment.
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // creates a RunLengthSegment that takes over the given runs, e.g., when loading a table
+  RunLengthSegment(std::shared_ptr<std::vector<T>> values, std::shared_ptr<std::vector<ChunkOffset>> end_positions);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position, found by a binary search over the runs
+  const T get(const size_t i) const;
+
+  // run-length segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // returns the value of each run
+  std::shared_ptr<const std::vector<T>> values() const;
+
+  // returns the (inclusive) position of the last element of each run
+  std::shared_ptr<const std::vector<ChunkOffset>> end_positions() const;
+
+  // return the number of runs
+  size_t run_count() const;
+
+  // return the number of entries
+  size_t size() const override;
+
+  SegmentType segment_type() const override;
+
+  // the zone map is computed when the segment is created
+  std::optional<ZoneMap> zone_map() const override;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _values;
+  std::shared_ptr<std::vector<ChunkOffset>> _end_positions;
+  std::optional<ZoneMap> _zone_map;
+};
+
+}  // namespace opossum
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "base_attribute_vector.hpp"
+#include "base_segment.hpp"
+#include "delta_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_segment_type.hpp"
+#include "run_length_segment.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// Segment iterables give operators typed access to the values of a segment, without the virtual call and the
+// AllTypeVariant of BaseSegment::operator[]. There is one iterable per segment type. Each of them has
+//
+//   for_each(functor)  calls the functor with a SegmentPosition for every row, in order, using the fastest way to
+//                      decode the segment (e.g., unpacking value ids block by block)
+//   get(chunk_offset)  returns the value at a single position
+//
+// Operators usually do not pick an iterable themselves, but call with_segment_iterable<T>(segment, functor), which
+// finds the type of the segment once (see resolve_segment_type) and calls the (generic) functor with the matching
+// iterable. The loops over the rows are then instantiated for every segment type and contain no virtual calls:
+//
+//   with_segment_iterable<T>(*segment, [&](const auto& iterable) {
+//     iterable.for_each([&](const auto& position) { sum += position.value; });
+//   });
+
+// A value of a segment and its position in the segment. V is the data type of the segment or, for the strings of
+// ValueSegments, std::string_view.
+template <typename V>
+struct SegmentPosition {
+  V value;
+  ChunkOffset chunk_offset;
+};
+
+template <typename T>
+class ValueSegmentIterable {
+ public:
+  // T, or std::string_view for the strings in a StringHeap
+  using Value = std::decay_t<decltype(std::declval<const ValueVector<T>&>()[0])>;
+
+  explicit ValueSegmentIterable(const ValueSegment<T>& segment) : _segment(segment) {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    const auto& values = _segment.values();
+    const auto size = static_cast<ChunkOffset>(values.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      functor(SegmentPosition<Value>{values[chunk_offset], chunk_offset});
+    }
+  }
+
+  Value get(const ChunkOffset chunk_offset) const { return _segment.values()[chunk_offset]; }
+
+ protected:
+  const ValueSegment<T>& _segment;
+};
+
+template <typename T>
+class DictionarySegmentIterable {
+ public:
+  using Value = T;
+
+  explicit DictionarySegmentIterable(const DictionarySegment<T>& segment) : _segment(segment) {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    const auto& dictionary = *_segment.dictionary();
+    const auto& attribute_vector = *_segment.attribute_vector();
+
+    auto value_ids = ValueIDBlock{};
+    for (size_t block_offset = 0; block_offset < _segment.size();) {
+      const auto decoded_count = attribute_vector.decode_block(block_offset, value_ids);
+      for (size_t index = 0; index < decoded_count; ++index) {
+        functor(SegmentPosition<Value>{dictionary[value_ids[index]], ChunkOffset(block_offset + index)});
+      }
+      block_offset += decoded_count;
+    }
+  }
+
+  Value get(const ChunkOffset chunk_offset) const { return _segment.get(chunk_offset); }
+
+ protected:
+  const DictionarySegment<T>& _segment;
+};
+
+template <typename T>
+class RunLengthSegmentIterable {
+ public:
+  using Value = T;
+
+  explicit RunLengthSegmentIterable(const RunLengthSegment<T>& segment) : _segment(segment) {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    const auto& values = *_segment.values();
+    const auto& end_positions = *_segment.end_positions();
+
+    auto run_start = ChunkOffset{0};
+    for (size_t run_index = 0; run_index < values.size(); ++run_index) {
+      const auto run_end = end_positions[run_index];
+      for (auto chunk_offset = run_start; chunk_offset <= run_end; ++chunk_offset) {
+        functor(SegmentPosition<Value>{values[run_index], chunk_offset});
+      }
+      run_start = run_end + 1;
+    }
+  }
+
+  Value get(const ChunkOffset chunk_offset) const { return _segment.get(chunk_offset); }
+
+ protected:
+  const RunLengthSegment<T>& _segment;
+};
+
+template <typename T>
+class FrameOfReferenceSegmentIterable {
+ public:
+  using Value = T;
+
+  explicit FrameOfReferenceSegmentIterable(const FrameOfReferenceSegment<T>& segment) : _segment(segment) {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    const auto& block_minima = *_segment.block_minima();
+    const auto& offsets = *_segment.offsets();
+
+    // blocks of the attribute vector never span two frames, as BLOCK_SIZE is a multiple of their size
+    auto decoded_offsets = ValueIDBlock{};
+    for (size_t decode_offset = 0; decode_offset < _segment.size();) {
+      const auto block_minimum =
+          static_cast<UnsignedT>(block_minima[decode_offset / FrameOfReferenceSegment<T>::BLOCK_SIZE]);
+      const auto decoded_count = offsets.decode_block(decode_offset, decoded_offsets);
+      for (size_t index = 0; index < decoded_count; ++index) {
+        const auto value = static_cast<T>(block_minimum + static_cast<UnsignedT>(decoded_offsets[index]));
+        functor(SegmentPosition<Value>{value, ChunkOffset(decode_offset + index)});
+      }
+      decode_offset += decoded_count;
+    }
+  }
+
+  Value get(const ChunkOffset chunk_offset) const { return _segment.get(chunk_offset); }
+
+ protected:
+  const FrameOfReferenceSegment<T>& _segment;
+};
+
+template <typename T>
+class DeltaSegmentIterable {
+ public:
+  using Value = T;
+
+  explicit DeltaSegmentIterable(const DeltaSegment<T>& segment) : _segment(segment) {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    auto values = typename DeltaSegment<T>::ValueBlock{};
+    for (size_t block_index = 0; block_index < _segment.checkpoints()->size(); ++block_index) {
+      const auto block_begin = block_index * DeltaSegment<T>::CHECKPOINT_INTERVAL;
+      const auto value_count = _segment.decode_block(block_index, values);
+      for (size_t index = 0; index < value_count; ++index) {
+        functor(SegmentPosition<Value>{values[index], ChunkOffset(block_begin + index)});
+      }
+    }
+  }
+
+  Value get(const ChunkOffset chunk_offset) const { return _segment.get(chunk_offset); }
+
+ protected:
+  const DeltaSegment<T>& _segment;
+};
+
+// returns the iterable of a segment that holds values
+template <typename T>
+ValueSegmentIterable<T> create_iterable(const ValueSegment<T>& segment) {
+  return ValueSegmentIterable<T>{segment};
+}
+
+template <typename T>
+DictionarySegmentIterable<T> create_iterable(const DictionarySegment<T>& segment) {
+  return DictionarySegmentIterable<T>{segment};
+}
+
+template <typename T>
+RunLengthSegmentIterable<T> create_iterable(const RunLengthSegment<T>& segment) {
+  return RunLengthSegmentIterable<T>{segment};
+}
+
+template <typename T>
+FrameOfReferenceSegmentIterable<T> create_iterable(const FrameOfReferenceSegment<T>& segment) {
+  return FrameOfReferenceSegmentIterable<T>{segment};
+}
+
+template <typename T>
+DeltaSegmentIterable<T> create_iterable(const DeltaSegment<T>& segment) {
+  return DeltaSegmentIterable<T>{segment};
+}
+
+// Calls the functor with the iterable of the given segment, which must not be a ReferenceSegment. The segment has to
+// hold values of type T.
+template <typename T, typename Functor>
+void with_data_segment_iterable(const BaseSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    if constexpr (std::is_same<std::decay_t<decltype(typed_segment)>, ReferenceSegment>::value) {
+      Fail("ReferenceSegments cannot reference other ReferenceSegments.");
+    } else {
+      functor(create_iterable(typed_segment));
+    }
+  });
+}
+
+// Yields the values that the positions of a ReferenceSegment point to, in the order of the position list. The chunk
+// offsets of the yielded positions are the indices into the position list. Consecutive positions in the same chunk
+// are resolved together, so the type of the referenced segment is only determined once per such run. for_each yields
+// values in the type of the referenced segment's iterable, so the functor has to be generic.
+template <typename T>
+class ReferenceSegmentIterable {
+ public:
+  explicit ReferenceSegmentIterable(const ReferenceSegment& segment) : _segment(segment) {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    const auto& referenced_table = *_segment.referenced_table();
+    const auto& pos_list = *_segment.pos_list();
+
+    for (size_t run_begin = 0; run_begin < pos_list.size();) {
+      const auto chunk_id = pos_list[run_begin].chunk_id;
+      auto run_end = run_begin + 1;
+      while (run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+
+      const auto referenced_segment =
+          referenced_table.get_chunk(chunk_id).get_segment(_segment.referenced_column_id());
+      with_data_segment_iterable<T>(*referenced_segment, [&](const auto& iterable) {
+        using Value = typename std::decay_t<decltype(iterable)>::Value;
+        for (auto index = run_begin; index < run_end; ++index) {
+          functor(SegmentPosition<Value>{iterable.get(pos_list[index].chunk_offset), ChunkOffset(index)});
+        }
+      });
+      run_begin = run_end;
+    }
+  }
+
+  T get(const ChunkOffset chunk_offset) const {
+    const auto& position = (*_segment.pos_list())[chunk_offset];
+    const auto referenced_segment =
+        _segment.referenced_table()->get_chunk(position.chunk_id).get_segment(_segment.referenced_column_id());
+    auto value = T{};
+    with_data_segment_iterable<T>(*referenced_segment,
+                                  [&](const auto& iterable) { value = T{iterable.get(position.chunk_offset)}; });
+    return value;
+  }
+
+ protected:
+  const ReferenceSegment& _segment;
+};
+
+// Calls the functor with the iterable of the given segment. The segment has to hold values of type T.
+template <typename T, typename Functor>
+void with_segment_iterable(const BaseSegment& segment, const Functor& functor) {
+  if (segment.segment_type() == SegmentType::Reference) {
+    functor(ReferenceSegmentIterable<T>{static_cast<const ReferenceSegment&>(segment)});
+    return;
+  }
+  with_data_segment_iterable<T>(segment, functor);
+}
+
+}  // namespace opossum
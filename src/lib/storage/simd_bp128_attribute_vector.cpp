@@ -0,0 +1,174 @@
+#include "simd_bp128_attribute_vector.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "bit_packed_attribute_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr size_t LANE_COUNT = 4;
+constexpr size_t ROWS_PER_BLOCK = ATTRIBUTE_VECTOR_BLOCK_SIZE / LANE_COUNT;
+constexpr size_t WORD_BITS = std::numeric_limits<uint32_t>::digits;
+
+static_assert(sizeof(ValueID) == sizeof(uint32_t), "ValueIDBlock cannot be written to as a sequence of uint32_t");
+
+// Position of a value id within the packed words of its block
+struct PackedPosition {
+  size_t word_index;
+  size_t bit_shift;
+  bool spans_two_words;
+};
+
+PackedPosition packed_position(const size_t i, const size_t bits_per_value) {
+  const auto index_in_block = i % ATTRIBUTE_VECTOR_BLOCK_SIZE;
+  const auto lane = index_in_block % LANE_COUNT;
+  const auto bit_offset = (index_in_block / LANE_COUNT) * bits_per_value;
+
+  const auto block_start = (i / ATTRIBUTE_VECTOR_BLOCK_SIZE) * LANE_COUNT * bits_per_value;
+  const auto word_index = block_start + (bit_offset / WORD_BITS) * LANE_COUNT + lane;
+  const auto bit_shift = bit_offset % WORD_BITS;
+  return {word_index, bit_shift, bit_shift + bits_per_value > WORD_BITS};
+}
+
+// Unpacks all rows of a block. Because the number of bits is a template parameter, the compiler can resolve the
+// shifts and the checks for value ids spanning two words at compile time and unroll the loop.
+template <size_t Bits>
+void unpack_block(const uint32_t* in, ValueIDBlock& out) {
+  constexpr auto mask = static_cast<uint32_t>(std::numeric_limits<uint32_t>::max() >> (WORD_BITS - Bits));
+
+#if defined(__SSE2__)
+  const auto* in_vectors = reinterpret_cast<const __m128i*>(in);
+  auto* out_vectors = reinterpret_cast<__m128i*>(out.data());
+  const auto mask_vector = _mm_set1_epi32(static_cast<int32_t>(mask));
+
+  for (size_t row = 0; row < ROWS_PER_BLOCK; ++row) {
+    const auto bit_offset = row * Bits;
+    const auto word_index = bit_offset / WORD_BITS;
+    const auto bit_shift = bit_offset % WORD_BITS;
+
+    auto values = _mm_srli_epi32(_mm_loadu_si128(in_vectors + word_index), static_cast<int>(bit_shift));
+    if (bit_shift + Bits > WORD_BITS) {
+      const auto next_values = _mm_loadu_si128(in_vectors + word_index + 1);
+      values = _mm_or_si128(values, _mm_slli_epi32(next_values, static_cast<int>(WORD_BITS - bit_shift)));
+    }
+    _mm_storeu_si128(out_vectors + row, _mm_and_si128(values, mask_vector));
+  }
+#else
+  for (size_t row = 0; row < ROWS_PER_BLOCK; ++row) {
+    const auto bit_offset = row * Bits;
+    const auto word_index = bit_offset / WORD_BITS;
+    const auto bit_shift = bit_offset % WORD_BITS;
+
+    for (size_t lane = 0; lane < LANE_COUNT; ++lane) {
+      auto value = in[word_index * LANE_COUNT + lane] >> bit_shift;
+      if (bit_shift + Bits > WORD_BITS) {
+        value |= in[(word_index + 1) * LANE_COUNT + lane] << (WORD_BITS - bit_shift);
+      }
+      out[row * LANE_COUNT + lane] = ValueID{value & mask};
+    }
+  }
+#endif
+}
+
+using UnpackFunction = void (*)(const uint32_t*, ValueIDBlock&);
+
+template <size_t... BitsMinusOne>
+constexpr std::array<UnpackFunction, sizeof...(BitsMinusOne)> make_unpack_functions(
+    std::index_sequence<BitsMinusOne...>) {
+  return {{&unpack_block<BitsMinusOne + 1>...}};
+}
+
+// unpack_functions[bits - 1] unpacks a block with the given number of bits per value
+constexpr auto unpack_functions = make_unpack_functions(std::make_index_sequence<WORD_BITS>{});
+
+}  // namespace
+
+SimdBp128AttributeVector::SimdBp128AttributeVector(const size_t size, const ValueID max_value,
+                                                   const PolymorphicAllocator<uint32_t>& allocator)
+    : _size(size),
+      _bits_per_value(bits_needed(max_value)),
+      _mask(std::numeric_limits<uint32_t>::max() >> (WORD_BITS - _bits_per_value)),
+      _words((size + ATTRIBUTE_VECTOR_BLOCK_SIZE - 1) / ATTRIBUTE_VECTOR_BLOCK_SIZE * LANE_COUNT * _bits_per_value,
+             allocator) {}
+
+SimdBp128AttributeVector::SimdBp128AttributeVector(const size_t size, const uint8_t bits_per_value,
+                                                   pmr_vector<uint32_t>&& words)
+    : _size(size),
+      _bits_per_value(bits_per_value),
+      _mask(std::numeric_limits<uint32_t>::max() >> (WORD_BITS - _bits_per_value)),
+      _words(std::move(words)) {
+  Assert(_bits_per_value > 0 && _bits_per_value <= WORD_BITS, "invalid number of bits");
+  Assert(_words.size() == (size + ATTRIBUTE_VECTOR_BLOCK_SIZE - 1) / ATTRIBUTE_VECTOR_BLOCK_SIZE * LANE_COUNT *
+                              _bits_per_value,
+         "words do not match the size");
+}
+
+ValueID SimdBp128AttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "index out of range");
+
+  const auto position = packed_position(i, _bits_per_value);
+  auto value = _words[position.word_index] >> position.bit_shift;
+  if (position.spans_two_words) {
+    value |= _words[position.word_index + LANE_COUNT] << (WORD_BITS - position.bit_shift);
+  }
+  return ValueID{value & _mask};
+}
+
+void SimdBp128AttributeVector::set(const size_t i, const ValueID value_id) {
+  Assert(i < _size, "index out of range");
+  Assert(static_cast<uint32_t>(value_id) <= _mask, "value_id can not be stored");
+
+  const auto position = packed_position(i, _bits_per_value);
+  const auto value = static_cast<uint32_t>(value_id);
+
+  auto& word = _words[position.word_index];
+  word = (word & ~(_mask << position.bit_shift)) | (value << position.bit_shift);
+
+  if (position.spans_two_words) {
+    const auto written_bits = WORD_BITS - position.bit_shift;
+    auto& next_word = _words[position.word_index + LANE_COUNT];
+    next_word = (next_word & ~(_mask >> written_bits)) | (value >> written_bits);
+  }
+}
+
+size_t SimdBp128AttributeVector::size() const { return _size; }
+
+size_t SimdBp128AttributeVector::estimate_memory_usage() const {
+  return sizeof(*this) + _words.capacity() * sizeof(uint32_t);
+}
+
+AttributeVectorWidth SimdBp128AttributeVector::width() const {
+  return static_cast<AttributeVectorWidth>((_bits_per_value + 7) / 8);
+}
+
+uint8_t SimdBp128AttributeVector::bits_per_value() const { return _bits_per_value; }
+
+const pmr_vector<uint32_t>& SimdBp128AttributeVector::words() const { return _words; }
+
+size_t SimdBp128AttributeVector::decode_block(const size_t offset, ValueIDBlock& out) const {
+  if (offset % ATTRIBUTE_VECTOR_BLOCK_SIZE != 0) {
+    return BaseAttributeVector::decode_block(offset, out);
+  }
+
+  _unpack_block(offset / ATTRIBUTE_VECTOR_BLOCK_SIZE, out);
+  return std::min(ATTRIBUTE_VECTOR_BLOCK_SIZE, _size - offset);
+}
+
+void SimdBp128AttributeVector::_unpack_block(const size_t block_index, ValueIDBlock& out) const {
+  const auto* block_words = _words.data() + block_index * LANE_COUNT * _bits_per_value;
+  unpack_functions[_bits_per_value - 1](block_words, out);
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// SimdBp128AttributeVector bit-packs value ids in blocks of ATTRIBUTE_VECTOR_BLOCK_SIZE (128) values, using the
+// layout of the SIMD-BP128 scheme (Lemire and Boytsov, "Decoding billions of integers per second through
+// vectorization"): Within a block, the value ids are distributed round robin over four 32-bit lanes, i.e., value id j
+// belongs to lane j % 4. Each lane is bit-packed on its own and the lanes are interleaved word by word, so that four
+// value ids can be unpacked at once from a single 128-bit register with a shift and a mask.
+//
+// All blocks use the same number of bits, which is derived from max_value. The last block is padded with zeros.
+class SimdBp128AttributeVector : public BaseAttributeVector {
+ public:
+  SimdBp128AttributeVector(const size_t size, const ValueID max_value,
+                           const PolymorphicAllocator<uint32_t>& allocator = {});
+
+  // creates an attribute vector that takes over the given packed words, e.g., when loading a table
+  SimdBp128AttributeVector(const size_t size, const uint8_t bits_per_value, pmr_vector<uint32_t>&& words);
+
+  ValueID get(const size_t i) const override;
+
+  void set(const size_t i, const ValueID value_id) override;
+
+  size_t size() const override;
+
+  AttributeVectorWidth width() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // Unpacks a full block at once if offset is the start of a block. Otherwise, it falls back to decoding the value ids
+  // one by one.
+  size_t decode_block(const size_t offset, ValueIDBlock& out) const override;
+
+  // returns the number of bits used to store a single value id
+  uint8_t bits_per_value() const;
+
+  // returns the packed value ids, e.g., to write them to a file
+  const pmr_vector<uint32_t>& words() const;
+
+ protected:
+  const size_t _size;
+  const uint8_t _bits_per_value;
+  const uint32_t _mask;
+
+  // holds 4 * _bits_per_value words per block
+  pmr_vector<uint32_t> _words;
+
+  void _unpack_block(const size_t block_index, ValueIDBlock& out) const;
+};
+
+}  // namespace opossum
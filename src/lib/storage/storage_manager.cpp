@@ -1,11 +1,20 @@
 #include "storage_manager.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <iomanip>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
 #include "utils/assert.hpp"
+#include "utils/binary_table.hpp"
 
 namespace opossum {
 
@@ -15,41 +24,138 @@ StorageManager& StorageManager::get() {
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  DebugAssert(!has_table(name), "can not add table: table name is already in use");
+  const auto lock = std::lock_guard{_mutex};
+  DebugAssert(!_table_mapping.count(name) && !_unloaded_table_files.count(name),
+              "can not add table: table name is already in use");
   _table_mapping.emplace(std::make_pair(name, table));
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  DebugAssert(has_table(name), "can not drop table: table name is not in use");
+  const auto lock = std::lock_guard{_mutex};
+  DebugAssert(_table_mapping.count(name) || _unloaded_table_files.count(name),
+              "can not drop table: table name is not in use");
   _table_mapping.erase(name);
+  _unloaded_table_files.erase(name);
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
-  DebugAssert(has_table(name), "can not retrieve table: table name is not in use");
-  return _table_mapping.find(name)->second;
+  auto file_name = std::string{};
+  auto loading_table = std::shared_future<std::shared_ptr<Table>>{};
+  auto promise = std::promise<std::shared_ptr<Table>>{};
+  {
+    const auto lock = std::lock_guard{_mutex};
+    const auto table_it = _table_mapping.find(name);
+    if (table_it != _table_mapping.end()) return table_it->second;
+    const auto file_it = _unloaded_table_files.find(name);
+    Assert(file_it != _unloaded_table_files.end(), "can not retrieve table: table name is not in use");
+
+    const auto loading_it = _loading_tables.find(name);
+    if (loading_it != _loading_tables.end()) {
+      loading_table = loading_it->second;
+    } else {
+      file_name = file_it->second;
+      _loading_tables.emplace(name, promise.get_future().share());
+    }
+  }
+  // another thread is loading the table already
+  if (loading_table.valid()) return loading_table.get();
+  return _load_table(name, file_name, promise);
 }
 
 bool StorageManager::has_table(const std::string& name) const {
-  return _table_mapping.find(name) != _table_mapping.end();
+  const auto lock = std::lock_guard{_mutex};
+  return _table_mapping.count(name) || _unloaded_table_files.count(name);
+}
+
+bool StorageManager::is_table_loaded(const std::string& name) const {
+  const auto lock = std::lock_guard{_mutex};
+  return _table_mapping.count(name);
 }
 
 std::vector<std::string> StorageManager::table_names() const {
+  const auto lock = std::lock_guard{_mutex};
   std::vector<std::string> table_names;
   for (auto table_pair : _table_mapping) {
     table_names.push_back(table_pair.first);
   }
+  for (auto file_pair : _unloaded_table_files) {
+    table_names.push_back(file_pair.first);
+  }
+  std::sort(table_names.begin(), table_names.end());
   return table_names;
 }
 
+void StorageManager::save_snapshot(const std::string& directory) const {
+  std::filesystem::create_directories(directory);
+  for (const auto& name : table_names()) {
+    const auto target_file = std::filesystem::path{directory} / (name + ".bin");
+
+    // Tables that have not been loaded yet are already stored in the same format, so their files are copied without
+    // loading them. Loaded tables may have been modified since they were restored and are written again.
+    auto source_file = std::filesystem::path{};
+    {
+      const auto lock = std::lock_guard{_mutex};
+      const auto file_it = _unloaded_table_files.find(name);
+      if (file_it != _unloaded_table_files.end()) source_file = file_it->second;
+    }
+    if (!source_file.empty()) {
+      if (std::filesystem::exists(target_file) && std::filesystem::equivalent(source_file, target_file)) continue;
+      std::filesystem::copy_file(source_file, target_file, std::filesystem::copy_options::overwrite_existing);
+      continue;
+    }
+
+    write_binary_table(*get_table(name), target_file.string());
+  }
+}
+
+void StorageManager::restore_snapshot(const std::string& directory) {
+  Assert(std::filesystem::is_directory(directory), "snapshot directory does not exist");
+
+  auto table_files = std::map<std::string, std::string>{};
+  for (const auto& entry : std::filesystem::directory_iterator{directory}) {
+    if (!entry.is_regular_file() || entry.path().extension() != ".bin") continue;
+    table_files.emplace(entry.path().stem().string(), entry.path().string());
+  }
+
+  const auto lock = std::lock_guard{_mutex};
+  for (const auto& [name, file_name] : table_files) {
+    Assert(!_table_mapping.count(name) && !_unloaded_table_files.count(name),
+           "can not restore table: table name is already in use");
+  }
+  _unloaded_table_files.merge(table_files);
+}
+
+std::shared_ptr<Table> StorageManager::_load_table(const std::string& name, const std::string& file_name,
+                                                   std::promise<std::shared_ptr<Table>>& promise) const {
+  // The file is loaded without holding the lock so that other tables can be retrieved in the meantime. Threads that
+  // retrieve the same table wait for the promise instead of loading it again. If loading fails, they get the error.
+  try {
+    const auto table = load_binary_table(file_name);
+    {
+      const auto lock = std::lock_guard{_mutex};
+      _loading_tables.erase(name);
+      Assert(_unloaded_table_files.erase(name), "table was dropped while it was being loaded");
+      _table_mapping.emplace(name, table);
+    }
+    promise.set_value(table);
+    return table;
+  } catch (...) {
+    {
+      const auto lock = std::lock_guard{_mutex};
+      _loading_tables.erase(name);
+    }
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+}
+
 const size_t C_PRINT_COLUMN_WIDTH = 25;
 
 void StorageManager::print(std::ostream& out) const {
   _print_header(out);
-  for (auto it : _table_mapping) {
-    auto table_name = it.first;
-    auto table = it.second;
-
-    _print_table(out, table_name, table);
+  // printing the statistics loads all tables that have not been loaded yet
+  for (const auto& table_name : table_names()) {
+    _print_table(out, table_name, get_table(table_name));
   }
 }
 
@@ -58,6 +164,8 @@ void StorageManager::_print_header(std::ostream& out) const {
   out << _pad_right("#columns", C_PRINT_COLUMN_WIDTH);
   out << _pad_right("#rows", C_PRINT_COLUMN_WIDTH);
   out << _pad_right("#chunks", C_PRINT_COLUMN_WIDTH);
+  out << _pad_right("memory_usage", C_PRINT_COLUMN_WIDTH);
+  out << _pad_right("compression_ratio", C_PRINT_COLUMN_WIDTH);
   out << std::endl;
 }
 
@@ -67,6 +175,22 @@ void StorageManager::_print_table(std::ostream& out, const std::string& table_na
   out << _pad_right(std::to_string(table->column_count()), C_PRINT_COLUMN_WIDTH);
   out << _pad_right(std::to_string(table->row_count()), C_PRINT_COLUMN_WIDTH);
   out << _pad_right(std::to_string(table->chunk_count()), C_PRINT_COLUMN_WIDTH);
+
+  // The plain values would take up sizeof(T) per row and column. For strings, this ignores the characters of long
+  // strings, which are stored outside of the string object.
+  auto plain_memory_usage = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    resolve_data_type(table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      plain_memory_usage += table->row_count() * sizeof(ColumnDataType);
+    });
+  }
+  const auto memory_usage = table->estimate_memory_usage();
+  auto compression_ratio = std::ostringstream{};
+  compression_ratio << std::fixed << std::setprecision(2)
+                    << static_cast<double>(plain_memory_usage) / static_cast<double>(memory_usage);
+  out << _pad_right(std::to_string(memory_usage), C_PRINT_COLUMN_WIDTH);
+  out << _pad_right(compression_ratio.str(), C_PRINT_COLUMN_WIDTH);
   out << std::endl;
 }
 
@@ -78,6 +202,14 @@ std::string StorageManager::_pad_right(std::string input, size_t total_width, ch
   return input;
 }
 
+StorageManager& StorageManager::operator=(StorageManager&& other) {
+  const auto lock = std::scoped_lock{_mutex, other._mutex};
+  _table_mapping = std::move(other._table_mapping);
+  _unloaded_table_files = std::move(other._unloaded_table_files);
+  _loading_tables = std::move(other._loading_tables);
+  return *this;
+}
+
 void StorageManager::reset() { get() = StorageManager(); }
 
 }  // namespace opossum
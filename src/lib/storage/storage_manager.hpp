@@ -1,8 +1,10 @@
 #pragma once
 
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -13,6 +15,10 @@ namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// Tables can be saved to and restored from a snapshot directory. Restored tables are registered right away, but their
+// data is only loaded from the snapshot when the table is first retrieved. Each table is loaded only once, threads that
+// retrieve it while it is being loaded wait for that load. All methods are thread-safe.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -32,9 +38,21 @@ class StorageManager : private Noncopyable {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
-  // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
+  // prints information about all tables in the storage manager (name, #columns, #rows, #chunks, memory usage in bytes,
+  // and compression ratio, i.e., the size of the plain values divided by the memory usage)
   void print(std::ostream& out = std::cout) const;
 
+  // writes all tables to the given directory (one binary table file per table). The files of restored tables that have
+  // not been loaded yet are copied instead.
+  void save_snapshot(const std::string& directory) const;
+
+  // registers all tables of a snapshot that has been written by save_snapshot. The tables are loaded lazily on the
+  // first get_table. Fails if a table name is already in use.
+  void restore_snapshot(const std::string& directory);
+
+  // returns whether the table has been loaded, i.e., it has been added directly or retrieved after a restore
+  bool is_table_loaded(const std::string& name) const;
+
   // deletes the entire StorageManager and creates a new one, used especially in tests
   void reset();
 
@@ -42,9 +60,21 @@ class StorageManager : private Noncopyable {
 
  protected:
   StorageManager() {}
-  StorageManager& operator=(StorageManager&&) = default;
+  StorageManager& operator=(StorageManager&& other);
+
+  // Loads a table that has been restored but not loaded yet from the given file, which get_table looked up in
+  // _unloaded_table_files, and fulfills the promise that get_table registered in _loading_tables. The _mutex must not
+  // be held by the caller.
+  std::shared_ptr<Table> _load_table(const std::string& name, const std::string& file_name,
+                                     std::promise<std::shared_ptr<Table>>& promise) const;
 
-  std::map<std::string, std::shared_ptr<Table>> _table_mapping;
+  // loaded tables and the files of restored tables that have not been loaded yet. A table name is in at most one of
+  // both maps. They are mutable because get_table moves tables from the latter to the former.
+  mutable std::map<std::string, std::shared_ptr<Table>> _table_mapping;
+  mutable std::map<std::string, std::string> _unloaded_table_files;
+  // the restored tables that are currently being loaded, which are still in _unloaded_table_files
+  mutable std::map<std::string, std::shared_future<std::shared_ptr<Table>>> _loading_tables;
+  mutable std::mutex _mutex;
 
   void _print_header(std::ostream& out) const;
   void _print_table(std::ostream& out, const std::string& table_name, std::shared_ptr<Table> table) const;
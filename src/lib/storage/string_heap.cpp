@@ -0,0 +1,37 @@
+#include "string_heap.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+StringHeap::StringHeap(pmr_vector<char>&& characters, pmr_vector<size_t>&& end_offsets)
+    : _characters(std::move(characters)), _end_offsets(std::move(end_offsets)) {
+  Assert(_end_offsets.empty() || _end_offsets.back() == _characters.size(), "end offsets do not match the characters");
+  DebugAssert(std::is_sorted(_end_offsets.cbegin(), _end_offsets.cend()), "end offsets have to be ascending");
+}
+
+std::string_view StringHeap::at(const size_t index) const {
+  Assert(index < size(), "index is out of range");
+  return (*this)[index];
+}
+
+void StringHeap::push_back(const std::string_view value) {
+  _characters.insert(_characters.end(), value.cbegin(), value.cend());
+  _end_offsets.push_back(_characters.size());
+}
+
+void StringHeap::reserve(const size_t string_count, const size_t character_count) {
+  _characters.reserve(character_count);
+  _end_offsets.reserve(string_count);
+}
+
+size_t StringHeap::estimate_memory_usage() const {
+  return _characters.capacity() + _end_offsets.capacity() * sizeof(size_t);
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// StringHeap is an append-only vector of strings that stores all characters back to back in a single buffer, plus the
+// offset at which each string ends. Compared to a std::vector<std::string>, appending does not allocate per string
+// (only when one of the two buffers grows), and scans read the characters sequentially.
+//
+// Strings are returned as std::string_view, which can be compared with std::strings without materializing them.
+// The views stay valid until the next push_back.
+class StringHeap {
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    Iterator() = default;
+    Iterator(const StringHeap& string_heap, const size_t index) : _string_heap(&string_heap), _index(index) {}
+
+    std::string_view operator*() const { return (*_string_heap)[_index]; }
+    std::string_view operator[](const difference_type offset) const { return (*_string_heap)[_index + offset]; }
+
+    Iterator& operator++() {
+      ++_index;
+      return *this;
+    }
+    Iterator operator++(int) { return Iterator{*_string_heap, _index++}; }
+    Iterator& operator--() {
+      --_index;
+      return *this;
+    }
+    Iterator operator--(int) { return Iterator{*_string_heap, _index--}; }
+    Iterator& operator+=(const difference_type offset) {
+      _index += offset;
+      return *this;
+    }
+    Iterator& operator-=(const difference_type offset) {
+      _index -= offset;
+      return *this;
+    }
+    Iterator operator+(const difference_type offset) const { return Iterator{*_string_heap, _index + offset}; }
+    Iterator operator-(const difference_type offset) const { return Iterator{*_string_heap, _index - offset}; }
+    difference_type operator-(const Iterator& other) const {
+      return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+    }
+
+    bool operator==(const Iterator& other) const { return _index == other._index; }
+    bool operator!=(const Iterator& other) const { return _index != other._index; }
+    bool operator<(const Iterator& other) const { return _index < other._index; }
+    bool operator>(const Iterator& other) const { return _index > other._index; }
+    bool operator<=(const Iterator& other) const { return _index <= other._index; }
+    bool operator>=(const Iterator& other) const { return _index >= other._index; }
+
+   protected:
+    const StringHeap* _string_heap = nullptr;
+    size_t _index = 0;
+  };
+
+  using const_iterator = Iterator;
+
+  explicit StringHeap(const PolymorphicAllocator<char>& allocator = {})
+      : _characters(allocator), _end_offsets(allocator) {}
+
+  // takes over the characters of all strings and the offset at which each string ends, e.g., when loading a table
+  StringHeap(pmr_vector<char>&& characters, pmr_vector<size_t>&& end_offsets);
+
+  // returns the string at the given index
+  std::string_view operator[](const size_t index) const {
+    const auto begin = index == 0 ? size_t{0} : _end_offsets[index - 1];
+    return std::string_view{_characters.data() + begin, _end_offsets[index] - begin};
+  }
+
+  // same as operator[], but checks the index
+  std::string_view at(const size_t index) const;
+
+  // adds a copy of the string to the end
+  void push_back(const std::string_view value);
+
+  // reserves memory for the given number of strings and characters
+  void reserve(const size_t string_count, const size_t character_count);
+
+  // returns the number of strings
+  size_t size() const { return _end_offsets.size(); }
+
+  bool empty() const { return _end_offsets.empty(); }
+
+  // returns the number of characters of all strings
+  size_t data_size() const { return _characters.size(); }
+
+  // returns the number of bytes allocated for the characters and offsets (excluding the StringHeap object itself)
+  size_t estimate_memory_usage() const;
+
+  // return the underlying buffers, e.g., to write them to a file
+  const pmr_vector<char>& characters() const { return _characters; }
+  const pmr_vector<size_t>& end_offsets() const { return _end_offsets; }
+
+  Iterator begin() const { return Iterator{*this, 0}; }
+  Iterator end() const { return Iterator{*this, size()}; }
+  Iterator cbegin() const { return begin(); }
+  Iterator cend() const { return end(); }
+
+ protected:
+  pmr_vector<char> _characters;
+  pmr_vector<size_t> _end_offsets;
+};
+
+}  // namespace opossum
@@ -1,28 +1,54 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <future>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "value_segment.hpp"
 
+#include "bloom_filter.hpp"
+#include "delta_segment.hpp"
 #include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
 #include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "segment_iterables.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _chunk_size{chunk_size} { create_new_chunk(); }
+Table::Table(const uint32_t chunk_size, std::pmr::memory_resource* memory_resource)
+    : _chunk_size{chunk_size}, _memory_resource{memory_resource} {
+  create_new_chunk();
+}
+
+Table::~Table() {
+  if (!_auto_compression_worker.joinable()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_auto_compression_mutex);
+    _stop_auto_compression = true;
+  }
+  _auto_compression_condition.notify_all();
+  _auto_compression_worker.join();
+}
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
   _column_names.push_back(name);
   _column_types.push_back(type);
+  _bloom_filter_columns.push_back(false);
+  _shared_dictionary_columns.push_back(false);
+  _shared_dictionaries.push_back(nullptr);
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
@@ -32,12 +58,13 @@ void Table::add_column(const std::string& name, const std::string& type) {
               "column name already exists");
 
   add_column_definition(name, type);
-  _chunks.front().add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
+  _chunks.front().add_segment(
+      make_shared_by_data_type<BaseSegment, ValueSegment>(type, PolymorphicAllocator<size_t>{_memory_resource}));
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
   if (_is_latest_chunk_full()) {
-    create_new_chunk();
+    _open_new_chunk();
   }
 
   _chunks.back().append(values);
@@ -54,13 +81,29 @@ bool Table::_is_chunk_full(const ChunkID chunk_id) const {
   return chunk.size() >= chunk_size();
 }
 
+void Table::_open_new_chunk() {
+  create_new_chunk();
+
+  // the previous chunk is full now and can be compressed
+  std::unique_lock<std::mutex> lock(_auto_compression_mutex);
+  if (_auto_compression_encoding) {
+    _auto_compression_queue.push_back(ChunkID{static_cast<uint32_t>(_chunks.size() - 2)});
+    lock.unlock();
+    _auto_compression_condition.notify_all();
+  }
+}
+
 void Table::create_new_chunk() {
   Chunk chunk;
+  const auto allocator = PolymorphicAllocator<size_t>{_memory_resource};
   for (const auto& column_type : _column_types) {
-    chunk.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(column_type));
+    chunk.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(column_type, allocator));
   }
 
+  std::unique_lock<std::shared_mutex> lock(_chunks_mutex);
   _chunks.emplace_back(std::move(chunk));
+  // the previous chunk is not appended to anymore
+  if (_chunks.size() > 1) _register_full_chunk(ChunkID{static_cast<uint32_t>(_chunks.size() - 2)});
 }
 
 uint16_t Table::column_count() const {
@@ -77,6 +120,24 @@ uint64_t Table::row_count() const {
   return count;
 }
 
+size_t Table::estimate_memory_usage() const {
+  std::shared_lock<std::shared_mutex> lock(const_cast<std::shared_mutex&>(_chunks_mutex));
+  auto memory_usage = sizeof(*this);
+  for (const auto& chunk : _chunks) {
+    memory_usage += chunk.estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+size_t Table::estimate_memory_usage(ColumnID column_id) const {
+  std::shared_lock<std::shared_mutex> lock(const_cast<std::shared_mutex&>(_chunks_mutex));
+  auto memory_usage = size_t{0};
+  for (const auto& chunk : _chunks) {
+    memory_usage += chunk.estimate_memory_usage(column_id);
+  }
+  return memory_usage;
+}
+
 ChunkID Table::chunk_count() const { return ChunkID{static_cast<const uint32_t&>(_chunks.size())}; }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
@@ -90,44 +151,410 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 
 uint32_t Table::chunk_size() const { return _chunk_size; }
 
+std::pmr::memory_resource* Table::memory_resource() const { return _memory_resource; }
+
 const std::vector<std::string>& Table::column_names() const { return _column_names; }
 
+const std::vector<std::string>& Table::column_types() const { return _column_types; }
+
 const std::string& Table::column_name(ColumnID column_id) const { return _column_names.at(column_id); }
 
 const std::string& Table::column_type(ColumnID column_id) const { return _column_types.at(column_id); }
 
 Chunk& Table::get_chunk(ChunkID chunk_id) {
   std::shared_lock<std::shared_mutex> lock(_chunks_mutex);
+  if (_buffer_manager) _buffer_manager->reference_chunk(chunk_id);
   return _chunks.at(chunk_id);
 }
 
 const Chunk& Table::get_chunk(ChunkID chunk_id) const {
   std::shared_lock<std::shared_mutex> lock(const_cast<std::shared_mutex&>(_chunks_mutex));
+  if (_buffer_manager) _buffer_manager->reference_chunk(chunk_id);
   return _chunks.at(chunk_id);
 }
 
 void Table::emplace_chunk(Chunk&& chunk) {
+  std::unique_lock<std::shared_mutex> lock(_chunks_mutex);
   if (_chunks.back().size() == 0) {
     _chunks.back() = std::move(chunk);
   } else {
     _chunks.emplace_back(std::move(chunk));
   }
+  _register_full_chunk(ChunkID{static_cast<uint32_t>(_chunks.size() - 1)});
+}
+
+void Table::enable_eviction(const size_t memory_budget, const std::string& spill_file_name) {
+  Assert(!_buffer_manager, "eviction is already enabled");
+
+  std::unique_lock<std::shared_mutex> lock(_chunks_mutex);
+  _buffer_manager = std::make_unique<BufferManager>(_column_types, memory_budget, spill_file_name, _memory_resource);
+  for (auto column_id = ColumnID{0}; column_id < _column_types.size(); ++column_id) {
+    if (const auto dictionary = shared_dictionary(column_id)) {
+      _buffer_manager->register_shared_dictionary(column_id, dictionary);
+    }
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    _register_full_chunk(chunk_id);
+  }
+}
+
+BufferManager* Table::buffer_manager() const { return _buffer_manager.get(); }
+
+void Table::prefetch_chunk(ChunkID chunk_id) const {
+  if (_buffer_manager) _buffer_manager->prefetch_chunk(chunk_id);
+}
+
+void Table::_register_full_chunk(const ChunkID chunk_id) {
+  if (_buffer_manager && _is_chunk_full(chunk_id)) _buffer_manager->register_chunk(_chunks[chunk_id], chunk_id);
+}
+
+void Table::enable_bloom_filter(ColumnID column_id) { _bloom_filter_columns.at(column_id) = true; }
+
+void Table::enable_shared_dictionary(ColumnID column_id) { _shared_dictionary_columns.at(column_id) = true; }
+
+bool Table::has_shared_dictionary(ColumnID column_id) const { return _shared_dictionary_columns.at(column_id); }
+
+std::shared_ptr<const void> Table::shared_dictionary(ColumnID column_id) const {
+  return std::atomic_load(&_shared_dictionaries.at(column_id));
+}
+
+void Table::set_shared_dictionary(ColumnID column_id, std::shared_ptr<const void> dictionary) {
+  std::lock_guard<std::mutex> lock(_shared_dictionaries_mutex);
+  _shared_dictionary_columns.at(column_id) = true;
+  if (_buffer_manager && dictionary) _buffer_manager->register_shared_dictionary(column_id, dictionary);
+  std::atomic_store(&_shared_dictionaries.at(column_id), std::move(dictionary));
+}
+
+void Table::compress_chunk(ChunkID chunk_id, EncodingType encoding_type) { compress_chunks({chunk_id}, encoding_type); }
+
+void Table::compress_chunks(const std::vector<ChunkID>& chunk_ids, EncodingType encoding_type) {
+  // Compressing segments with a shared dictionary might re-encode the segments of other chunks. Thus, chunks of
+  // tables with shared dictionaries are compressed one call after another.
+  auto shared_dictionaries_lock = std::unique_lock<std::mutex>(_shared_dictionaries_mutex, std::defer_lock);
+  if (std::find(_shared_dictionary_columns.cbegin(), _shared_dictionary_columns.cend(), true) !=
+      _shared_dictionary_columns.cend()) {
+    shared_dictionaries_lock.lock();
+  }
+
+  // The lock only protects against _chunks being reallocated by a concurrent append, so it is not held while
+  // compressing. The segments are collected per column.
+  auto uncompressed_segments = std::vector<std::vector<std::shared_ptr<BaseSegment>>>(column_count());
+  {
+    std::shared_lock<std::shared_mutex> lock(_chunks_mutex);
+    for (const auto chunk_id : chunk_ids) {
+      Assert(_is_chunk_full(chunk_id), "chunk is not full");
+
+      const auto& uncompressed_chunk = _chunks.at(chunk_id);
+      for (ColumnID column_id = ColumnID{0}; column_id < uncompressed_chunk.column_count(); ++column_id) {
+        uncompressed_segments[column_id].push_back(uncompressed_chunk.get_segment(column_id));
+      }
+    }
+  }
+
+  // The columns are independent of each other, so each one is compressed (and its Bloom filters are built) in its own
+  // thread. The segments of a column with a shared dictionary are compressed together, so that the dictionary is
+  // extended only once.
+  using CompressedSegments =
+      std::pair<std::vector<std::shared_ptr<BaseSegment>>, std::vector<std::shared_ptr<const BloomFilter>>>;
+  auto compressed_segments = std::vector<std::future<CompressedSegments>>();
+  for (ColumnID column_id = ColumnID{0}; column_id < uncompressed_segments.size(); ++column_id) {
+    compressed_segments.emplace_back(std::async(std::launch::async, [this, column_id, encoding_type,
+                                                                     &uncompressed_segments]() {
+      const auto& column_segments = uncompressed_segments[column_id];
+      auto segments = CompressedSegments{};
+      if (encoding_type == EncodingType::Dictionary && _shared_dictionary_columns.at(column_id)) {
+        resolve_data_type(column_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          segments.first = _compress_with_shared_dictionary<ColumnDataType>(column_id, column_segments);
+        });
+      } else {
+        for (const auto& segment : column_segments) {
+          segments.first.push_back(_compress_segment(column_id, segment, encoding_type));
+        }
+      }
+      for (const auto& segment : column_segments) segments.second.push_back(_build_bloom_filter(column_id, segment));
+      return segments;
+    }));
+  }
+
+  // get() rethrows exceptions of the threads, e.g., for an encoding that does not support the column's type. All
+  // threads are waited for first, so that none of them is still running when such an exception is thrown.
+  for (auto& compressed_segment : compressed_segments) compressed_segment.wait();
+  auto segments = std::vector<CompressedSegments>();
+  for (auto& compressed_segment : compressed_segments) segments.push_back(compressed_segment.get());
+
+  // Readers are not blocked: each segment is swapped atomically, and they hold a shared lock themselves.
+  std::shared_lock<std::shared_mutex> lock(_chunks_mutex);
+  for (size_t index = 0; index < chunk_ids.size(); ++index) {
+    auto& chunk = _chunks.at(chunk_ids[index]);
+    for (ColumnID column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+      // a chunk that is compressed again keeps its Bloom filter, as its values did not change
+      if (segments[column_id].second[index]) chunk.set_bloom_filter(column_id, segments[column_id].second[index]);
+      chunk.replace_segment(column_id, segments[column_id].first[index]);
+    }
+  }
+}
+
+void Table::set_sorted_by(ColumnID column_id, SortMode sort_mode) {
+  std::shared_lock<std::shared_mutex> lock(_chunks_mutex);
+  resolve_data_type(column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    for (auto& chunk : _chunks) {
+      auto is_sorted = true;
+      auto previous_value = std::optional<ColumnDataType>{};
+      with_segment_iterable<ColumnDataType>(*chunk.get_segment(column_id), [&](const auto& iterable) {
+        iterable.for_each([&](const auto& position) {
+          const auto value = ColumnDataType{position.value};
+          if (previous_value) {
+            is_sorted &= sort_mode == SortMode::Ascending ? !(value < *previous_value) : !(*previous_value < value);
+          }
+          previous_value = value;
+        });
+      });
+      Assert(is_sorted, "the values of the column are not in the given order");
+    }
+  });
+
+  for (auto& chunk : _chunks) chunk.set_sorted_by(column_id, sort_mode);
 }
 
-void Table::compress_chunk(ChunkID chunk_id) {
+void Table::sort_chunk(ChunkID chunk_id, ColumnID column_id, SortMode sort_mode) {
+  std::shared_lock<std::shared_mutex> lock(_chunks_mutex);
   Assert(_is_chunk_full(chunk_id), "chunk is not full");
+  auto& chunk = _chunks.at(chunk_id);
+
+  // the positions of the rows in their new order
+  auto permutation = std::vector<ChunkOffset>(chunk.size());
+  std::iota(permutation.begin(), permutation.end(), ChunkOffset{0});
+  resolve_data_type(column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk.get_segment(column_id));
+    Assert(value_segment, "only chunks of ValueSegments can be sorted");
+
+    const auto& values = value_segment->values();
+    if (sort_mode == SortMode::Ascending) {
+      std::stable_sort(permutation.begin(), permutation.end(),
+                       [&](const auto left, const auto right) { return values[left] < values[right]; });
+    } else {
+      std::stable_sort(permutation.begin(), permutation.end(),
+                       [&](const auto left, const auto right) { return values[right] < values[left]; });
+    }
+  });
+
+  for (auto sorted_column_id = ColumnID{0}; sorted_column_id < chunk.column_count(); ++sorted_column_id) {
+    resolve_data_type(column_type(sorted_column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value_segment =
+          std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk.get_segment(sorted_column_id));
+      Assert(value_segment, "only chunks of ValueSegments can be sorted");
+
+      const auto& values = value_segment->values();
+      auto sorted_values = ValueVector<ColumnDataType>(PolymorphicAllocator<ColumnDataType>{_memory_resource});
+      if constexpr (std::is_same<ColumnDataType, std::string>::value) {
+        sorted_values.reserve(values.size(), values.data_size());
+      } else {
+        sorted_values.reserve(values.size());
+      }
+      for (const auto chunk_offset : permutation) sorted_values.push_back(values[chunk_offset]);
+      chunk.replace_segment(sorted_column_id, std::make_shared<ValueSegment<ColumnDataType>>(std::move(sorted_values)));
+    });
+    chunk.set_sorted_by(sorted_column_id, std::nullopt);
+  }
+  chunk.set_sorted_by(column_id, sort_mode);
+}
+
+void Table::enable_auto_compression(EncodingType encoding_type) {
+  Assert(!_auto_compression_worker.joinable(), "auto compression is already enabled");
 
-  const auto& uncompressed_chunk = _chunks.at(chunk_id);
-  auto compressed_chunk = Chunk();
-  for (ColumnID column_id = ColumnID{0}; column_id < uncompressed_chunk.column_count(); ++column_id) {
-    const auto uncompressed_segment = uncompressed_chunk.get_segment(column_id);
-    const auto compressed_segment =
-        make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type(column_id), uncompressed_segment);
-    compressed_chunk.add_segment(compressed_segment);
+  {
+    std::lock_guard<std::mutex> lock(_auto_compression_mutex);
+    _auto_compression_encoding = encoding_type;
   }
+  _auto_compression_worker = std::thread(&Table::_auto_compress, this);
+}
 
-  std::unique_lock<std::shared_mutex> lock(_chunks_mutex);
-  _chunks.at(chunk_id) = std::move(compressed_chunk);
+void Table::wait_for_auto_compression() {
+  std::unique_lock<std::mutex> lock(_auto_compression_mutex);
+  _auto_compression_condition.wait(lock,
+                                   [&]() { return _auto_compression_queue.empty() && !_is_auto_compressing; });
+
+  if (_auto_compression_exception) {
+    const auto exception = _auto_compression_exception;
+    _auto_compression_exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+void Table::_auto_compress() {
+  std::unique_lock<std::mutex> lock(_auto_compression_mutex);
+  while (true) {
+    _auto_compression_condition.wait(lock,
+                                     [&]() { return _stop_auto_compression || !_auto_compression_queue.empty(); });
+    if (_stop_auto_compression) return;
+
+    // All chunks that have been filled in the meantime are compressed together, which extends shared dictionaries
+    // only once.
+    const auto chunk_ids = std::vector<ChunkID>(_auto_compression_queue.cbegin(), _auto_compression_queue.cend());
+    _auto_compression_queue.clear();
+    _is_auto_compressing = true;
+    lock.unlock();
+
+    // An exception would terminate the worker thread, so it is kept for wait_for_auto_compression().
+    auto exception = std::exception_ptr{};
+    try {
+      compress_chunks(chunk_ids, *_auto_compression_encoding);
+    } catch (...) {
+      exception = std::current_exception();
+    }
+
+    lock.lock();
+    if (exception && !_auto_compression_exception) _auto_compression_exception = exception;
+    _is_auto_compressing = false;
+    _auto_compression_condition.notify_all();
+  }
+}
+
+std::shared_ptr<const BloomFilter> Table::_build_bloom_filter(
+    const ColumnID column_id, const std::shared_ptr<BaseSegment>& uncompressed_segment) const {
+  if (!_bloom_filter_columns.at(column_id)) return nullptr;
+
+  auto bloom_filter = std::shared_ptr<const BloomFilter>{};
+  resolve_data_type(column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(uncompressed_segment);
+    if (value_segment) bloom_filter = make_bloom_filter(value_segment->values());
+  });
+  return bloom_filter;
+}
+
+template <typename T>
+std::vector<std::shared_ptr<BaseSegment>> Table::_compress_with_shared_dictionary(
+    const ColumnID column_id, const std::vector<std::shared_ptr<BaseSegment>>& uncompressed_segments) {
+  // Each segment is dictionary encoded on its own first, which yields its sorted distinct values.
+  auto segments = std::vector<std::shared_ptr<const DictionarySegment<T>>>();
+  segments.reserve(uncompressed_segments.size());
+  for (const auto& uncompressed_segment : uncompressed_segments) {
+    segments.push_back(std::make_shared<DictionarySegment<T>>(uncompressed_segment));
+  }
+  auto shared_dictionary = std::static_pointer_cast<const DictionaryType<T>>(_shared_dictionaries[column_id]);
+  const auto allocator = PolymorphicAllocator<T>{_memory_resource};
+
+  // The values that are not in the shared dictionary yet are collected from all segments, so that the dictionary is
+  // rebuilt (and the other segments of the column are re-encoded) at most once per call.
+  auto new_values = std::vector<T>();
+  for (const auto& segment : segments) {
+    const auto& segment_dictionary = *segment->dictionary();
+    for (size_t value_id = 0; value_id < segment_dictionary.size(); ++value_id) {
+      auto value = T{segment_dictionary[value_id]};
+      if (shared_dictionary) {
+        const auto shared_value_id = dictionary_bound<T>(*shared_dictionary, value, false);
+        if (shared_value_id < shared_dictionary->size() && (*shared_dictionary)[shared_value_id] == value) continue;
+      }
+      new_values.push_back(std::move(value));
+    }
+  }
+
+  if (!new_values.empty()) {
+    std::sort(new_values.begin(), new_values.end());
+    new_values.erase(std::unique(new_values.begin(), new_values.end()), new_values.end());
+
+    auto old_values = std::vector<T>();
+    for (size_t value_id = 0; shared_dictionary && value_id < shared_dictionary->size(); ++value_id) {
+      old_values.push_back((*shared_dictionary)[value_id]);
+    }
+    auto values = std::vector<T>();
+    values.reserve(old_values.size() + new_values.size());
+    std::merge(old_values.cbegin(), old_values.cend(), new_values.cbegin(), new_values.cend(),
+               std::back_inserter(values));
+    const auto new_dictionary = std::make_shared<const DictionaryType<T>>(values.cbegin(), values.cend(), allocator);
+    if (_buffer_manager) _buffer_manager->register_shared_dictionary(column_id, new_dictionary);
+    std::atomic_store(&_shared_dictionaries[column_id], std::shared_ptr<const void>{new_dictionary});
+
+    // All segments that use the old shared dictionary are re-encoded, so that the value ids of all chunks stay
+    // comparable. Their readers are not blocked, as the segments are swapped atomically. Evicted chunks are not loaded
+    // for this, the buffer manager re-encodes their segments when they are loaded again.
+    if (shared_dictionary) {
+      const auto value_id_mapping = map_value_ids<T>(*shared_dictionary, *new_dictionary);
+      std::shared_lock<std::shared_mutex> lock(_chunks_mutex);
+      for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+        if (_buffer_manager && !_buffer_manager->is_chunk_resident(chunk_id)) continue;
+        auto& chunk = _chunks[chunk_id];
+        const auto old_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(chunk.get_segment(column_id));
+        if (!old_segment || old_segment->dictionary() != shared_dictionary) continue;
+        chunk.replace_segment(column_id, std::make_shared<DictionarySegment<T>>(*old_segment, new_dictionary,
+                                                                                value_id_mapping, allocator));
+      }
+    }
+    shared_dictionary = new_dictionary;
+  }
+
+  auto compressed_segments = std::vector<std::shared_ptr<BaseSegment>>();
+  compressed_segments.reserve(segments.size());
+  for (const auto& segment : segments) {
+    compressed_segments.push_back(std::make_shared<DictionarySegment<T>>(
+        *segment, shared_dictionary, map_value_ids<T>(*segment->dictionary(), *shared_dictionary), allocator));
+  }
+  return compressed_segments;
+}
+
+std::shared_ptr<BaseSegment> Table::_compress_segment(const ColumnID column_id,
+                                                    const std::shared_ptr<BaseSegment>& uncompressed_segment,
+                                                    const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Dictionary: {
+      if (_shared_dictionary_columns.at(column_id)) {
+        auto compressed_segment = std::shared_ptr<BaseSegment>{};
+        resolve_data_type(column_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          compressed_segment =
+              _compress_with_shared_dictionary<ColumnDataType>(column_id, {uncompressed_segment}).front();
+        });
+        return compressed_segment;
+      }
+      return make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type(column_id), uncompressed_segment,
+                                                                      PolymorphicAllocator<size_t>{_memory_resource});
+    }
+    case EncodingType::RunLength:
+      return make_shared_by_data_type<BaseSegment, RunLengthSegment>(column_type(column_id), uncompressed_segment);
+    case EncodingType::FrameOfReference: {
+      auto compressed_segment = std::shared_ptr<BaseSegment>{};
+      resolve_data_type(column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        if constexpr (std::is_integral<ColumnDataType>::value) {
+          // segments whose values are too far apart for the offsets are dictionary encoded instead
+          if (FrameOfReferenceSegment<ColumnDataType>::is_encodable(uncompressed_segment)) {
+            compressed_segment = std::make_shared<FrameOfReferenceSegment<ColumnDataType>>(uncompressed_segment);
+          } else {
+            compressed_segment = _compress_segment(column_id, uncompressed_segment, EncodingType::Dictionary);
+          }
+        } else {
+          Fail("FrameOfReference encoding is only supported for integral columns");
+        }
+      });
+      return compressed_segment;
+    }
+    case EncodingType::Delta: {
+      auto compressed_segment = std::shared_ptr<BaseSegment>{};
+      resolve_data_type(column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        if constexpr (std::is_integral<ColumnDataType>::value) {
+          // segments whose neighbouring values are too far apart for the deltas are dictionary encoded instead
+          if (DeltaSegment<ColumnDataType>::is_encodable(uncompressed_segment)) {
+            compressed_segment = std::make_shared<DeltaSegment<ColumnDataType>>(uncompressed_segment);
+          } else {
+            compressed_segment = _compress_segment(column_id, uncompressed_segment, EncodingType::Dictionary);
+          }
+        } else {
+          Fail("Delta encoding is only supported for integral columns");
+        }
+      });
+      return compressed_segment;
+    }
+    default:
+      Fail("Unknown encoding type");
+  }
+  return nullptr;
 }
 
 }  // namespace opossum
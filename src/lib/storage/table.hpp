@@ -1,22 +1,35 @@
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "buffer_manager.hpp"
 #include "chunk.hpp"
 
+#include "resolve_type.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
+class BloomFilter;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -25,7 +38,14 @@ class Table : private Noncopyable {
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default is the maximum chunk size minus 1. A table holds always at least one chunk
-  explicit Table(const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+  // The values of the ValueSegments and DictionarySegments of the table are allocated from the given memory resource,
+  // which has to outlive the table. As compress_chunk compresses the columns in parallel, the resource has to be
+  // thread-safe. E.g., with a std::pmr::synchronized_pool_resource on top of a std::pmr::monotonic_buffer_resource,
+  // dropping the table frees a few large buffers instead of every vector. Note that such an arena does not give the
+  // memory of segments that have been replaced by compress_chunk back to the system.
+  // A HugePageMemoryResource backs the large segment buffers of the table with huge pages.
+  explicit Table(const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+                 std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
@@ -33,6 +53,9 @@ class Table : private Noncopyable {
 
   Table& operator=(Table&&) = default;
 
+  // stops the background compression, if enabled
+  ~Table();
+
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t column_count() const;
 
@@ -44,6 +67,13 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
+  // Returns the number of bytes used by all chunks of the table. Compare it before and after compress_chunk to see
+  // what the compression saves.
+  size_t estimate_memory_usage() const;
+
+  // returns the number of bytes used by the segments (and Bloom filters) of the given column
+  size_t estimate_memory_usage(ColumnID column_id) const;
+
   // returns the chunk with the given id
   Chunk& get_chunk(ChunkID chunk_id);
 
@@ -55,6 +85,9 @@ class Table : private Noncopyable {
   // Returns a list of all column names.
   const std::vector<std::string>& column_names() const;
 
+  // Returns a list of all column types.
+  const std::vector<std::string>& column_types() const;
+
   // returns the column name of the nth column
   const std::string& column_name(ColumnID column_id) const;
 
@@ -69,6 +102,9 @@ class Table : private Noncopyable {
   // return the maximum chunk size (cannot exceed ChunkOffset (uint32_t))
   uint32_t chunk_size() const;
 
+  // returns the memory resource that the segments of the table are allocated from
+  std::pmr::memory_resource* memory_resource() const;
+
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
@@ -83,21 +119,172 @@ class Table : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(std::vector<AllTypeVariant> values);
 
+  // Inserts many rows at once, given as one vector of values per column. The vectors must have the data types of the
+  // columns (e.g., std::vector<int32_t> for an int column) and the same size. Their values are moved into the
+  // ValueSegments in bulk, and new chunks are created as needed. Pass the vectors with std::move to avoid copying.
+  //   table.append_columns(std::move(ids), std::move(names));
+  template <typename... Types>
+  void append_columns(std::vector<Types>... columns);
+
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  // compresses a ValueSegment into a DictionarySegment
-  void compress_chunk(ChunkID chunk_id);
+  // Builds a Bloom filter for the segments of the given column whenever a chunk is compressed, so that equality scans
+  // can skip chunks that do not contain the search value. Worthwhile for high-cardinality columns, where zone maps do
+  // not help. Chunks that are already compressed are not affected.
+  void enable_bloom_filter(ColumnID column_id);
+
+  // Makes the DictionarySegments of the given column share a single, sorted dictionary, so that each value is stored
+  // only once per table and value ids are comparable across chunks. When chunks with values that are not yet in the
+  // dictionary are compressed, the dictionary is rebuilt and the other segments of the column are re-encoded, which
+  // compress_chunks does once for all given chunks. Evicted chunks are re-encoded when they are loaded again. Chunks
+  // that are already compressed are not affected.
+  void enable_shared_dictionary(ColumnID column_id);
+
+  // returns whether enable_shared_dictionary has been called for the given column
+  bool has_shared_dictionary(ColumnID column_id) const;
+
+  // Returns the dictionary that the DictionarySegments of the given column share (a DictionaryType<T> of the column's
+  // data type), or nullptr if no chunk has been compressed with it yet. Can be called while chunks are compressed.
+  std::shared_ptr<const void> shared_dictionary(ColumnID column_id) const;
+
+  // Enables the shared dictionary of the given column and sets it, e.g., when loading a table whose segments use it.
+  // The dictionary has to be a DictionaryType<T> of the column's data type.
+  void set_shared_dictionary(ColumnID column_id, std::shared_ptr<const void> dictionary);
+
+  // Marks the given column as sorted in all chunks, e.g., after loading data that is already ordered by it. Checks
+  // that the values of each chunk are in that order. Scans use binary search on sorted segments, see Chunk::sorted_by.
+  // Appending values to a chunk clears its flag again.
+  void set_sorted_by(ColumnID column_id, SortMode sort_mode);
+
+  // Reorders the rows of a full chunk of ValueSegments by the given column and marks the column as sorted. The order
+  // of rows with equal values is kept. The segments are replaced one by one, so this must not run concurrently with
+  // readers of the chunk, which could otherwise combine segments in different orders. Compress the chunk afterwards.
+  void sort_chunk(ChunkID chunk_id, ColumnID column_id, SortMode sort_mode = SortMode::Ascending);
+
+  // compresses the ValueSegments of a full chunk using the given encoding
+  // segments that the encoding can not represent (see FrameOfReferenceSegment::is_encodable and
+  // DeltaSegment::is_encodable) are dictionary encoded instead
+  // the segments are replaced one by one, concurrent readers of the chunk are not blocked
+  void compress_chunk(ChunkID chunk_id, EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Compresses several full chunks like compress_chunk. The values that they add to a shared dictionary are added in
+  // one go, so the other segments of the column are re-encoded at most once. Prefer it when compressing many chunks.
+  void compress_chunks(const std::vector<ChunkID>& chunk_ids, EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Starts a background worker that compresses each chunk as soon as append() has filled it and opened a new one.
+  // This way, appending does not have to wait for the compression. Can only be enabled once.
+  void enable_auto_compression(EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Keeps the full chunks of the table within the given memory budget (in bytes of their segments) by evicting them to
+  // the given spill file, see BufferManager. Evicted chunks are loaded back when their segments are requested. Can only
+  // be enabled once. Like appending in general, this must not run concurrently with readers of the table.
+  void enable_eviction(size_t memory_budget, const std::string& spill_file_name);
+
+  // returns the buffer manager of the table, or nullptr if eviction is not enabled
+  BufferManager* buffer_manager() const;
+
+  // Starts loading the chunk in the background if it has been evicted, e.g., while the previous chunk is scanned.
+  // Does nothing if eviction is not enabled.
+  void prefetch_chunk(ChunkID chunk_id) const;
+
+  // blocks until the background worker has compressed all queued chunks
+  // rethrows the first exception that occurred during background compression, if any
+  void wait_for_auto_compression();
 
  protected:
-  std::vector<Chunk> _chunks;
+  // a deque, so that chunks keep their address when chunks are added, which the buffer manager relies on
+  std::deque<Chunk> _chunks;
   uint32_t _chunk_size;
+  std::pmr::memory_resource* _memory_resource;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  std::vector<bool> _bloom_filter_columns;
+
+  // the shared dictionary (a DictionaryType<T>) of each column, nullptr if there is none (yet)
+  // guarded by _shared_dictionaries_mutex, which is held while compressing a chunk of a table with shared dictionaries,
+  // and replaced atomically, so that shared_dictionary() does not need the mutex
+  std::vector<bool> _shared_dictionary_columns;
+  std::vector<std::shared_ptr<const void>> _shared_dictionaries;
+  std::mutex _shared_dictionaries_mutex;
   std::shared_mutex _chunks_mutex;
 
+  // state of the background compression, guarded by _auto_compression_mutex
+  std::optional<EncodingType> _auto_compression_encoding;
+  std::deque<ChunkID> _auto_compression_queue;
+  bool _is_auto_compressing = false;
+  bool _stop_auto_compression = false;
+  std::exception_ptr _auto_compression_exception;
+  std::mutex _auto_compression_mutex;
+  std::condition_variable _auto_compression_condition;
+  std::thread _auto_compression_worker;
+
+  // set if eviction is enabled, declared last so that it is destroyed before the chunks
+  std::unique_ptr<BufferManager> _buffer_manager;
+
+  void _register_full_chunk(ChunkID chunk_id);
   bool _is_chunk_full(const ChunkID chunk_id) const;
   bool _is_latest_chunk_full() const;
   void _open_new_chunk();
+  template <typename T>
+  bool _has_data_type(ColumnID column_id) const;
+  template <typename T>
+  void _append_values(ColumnID column_id, std::vector<T>&& values, const size_t offset, const size_t count);
+  void _auto_compress();
+  std::shared_ptr<const BloomFilter> _build_bloom_filter(
+      const ColumnID column_id, const std::shared_ptr<BaseSegment>& uncompressed_segment) const;
+  template <typename T>
+  std::vector<std::shared_ptr<BaseSegment>> _compress_with_shared_dictionary(
+      const ColumnID column_id, const std::vector<std::shared_ptr<BaseSegment>>& uncompressed_segments);
+  std::shared_ptr<BaseSegment> _compress_segment(const ColumnID column_id,
+                                                 const std::shared_ptr<BaseSegment>& uncompressed_segment,
+                                                 const EncodingType encoding_type);
 };
+
+template <typename... Types>
+void Table::append_columns(std::vector<Types>... columns) {
+  Assert(sizeof...(Types) == column_count(), "number of columns does not match");
+
+  // all checks are done first, so that a mismatch does not leave a partially appended batch behind
+  auto column_id = ColumnID{0};
+  const auto type_matches = std::vector<bool>{_has_data_type<Types>(ColumnID{column_id++})...};
+  Assert(std::find(type_matches.cbegin(), type_matches.cend(), false) == type_matches.cend(),
+         "data types of the columns do not match");
+
+  const auto row_counts = std::vector<size_t>{columns.size()...};
+  Assert(std::adjacent_find(row_counts.cbegin(), row_counts.cend(), std::not_equal_to<size_t>()) == row_counts.cend(),
+         "all columns need to have the same number of values");
+
+  const auto row_count = row_counts.empty() ? size_t{0} : row_counts.front();
+  auto offset = size_t{0};
+  while (offset < row_count) {
+    if (_is_latest_chunk_full()) {
+      _open_new_chunk();
+    }
+
+    const auto count = std::min(row_count - offset, size_t{chunk_size() - _chunks.back().size()});
+    auto value_column_id = ColumnID{0};
+    (_append_values(ColumnID{value_column_id++}, std::move(columns), offset, count), ...);
+    offset += count;
+  }
+}
+
+template <typename T>
+bool Table::_has_data_type(ColumnID column_id) const {
+  auto has_data_type = false;
+  resolve_data_type(column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    has_data_type = std::is_same<ColumnDataType, T>::value;
+  });
+  return has_data_type;
+}
+
+template <typename T>
+void Table::_append_values(ColumnID column_id, std::vector<T>&& values, const size_t offset, const size_t count) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(_chunks.back().get_segment(column_id));
+  Assert(value_segment, "the latest chunk is not made up of ValueSegments");
+  value_segment->append_values(std::move(values), offset, count);
+  if (count > 0) _chunks.back().set_sorted_by(column_id, std::nullopt);
+}
+
 }  // namespace opossum
@@ -1,9 +1,13 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -14,18 +18,58 @@
 namespace opossum {
 
 template <typename T>
-ValueSegment<T>::ValueSegment() {}
+ValueSegment<T>::ValueSegment(const PolymorphicAllocator<T>& allocator) : _values(allocator) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(ValueVector<T>&& values) : _values(std::move(values)) {
+  if (_values.empty()) return;
+  const auto [min_it, max_it] = std::minmax_element(_values.cbegin(), _values.cend());
+  _min = T{*min_it};
+  _max = T{*max_it};
+}
 
 template <typename T>
 const AllTypeVariant ValueSegment<T>::operator[](const size_t offset) const {
   PerformanceWarning("operator[] used");
 
-  return _values.at(offset);
+  return T{_values.at(offset)};
 }
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
-  _values.push_back(type_cast<T>(val));
+  const auto value = type_cast<T>(val);
+  if (_values.empty() || value < _min) _min = value;
+  if (_values.empty() || value > _max) _max = value;
+  _values.push_back(value);
+}
+
+template <typename T>
+void ValueSegment<T>::append_values(std::vector<T>&& values, const size_t offset, const size_t count) {
+  DebugAssert(offset + count <= values.size(), "values out of range");
+  if (count == 0) return;
+
+  const auto begin = values.begin() + offset;
+  const auto [min_it, max_it] = std::minmax_element(begin, begin + count);
+  if (_values.empty() || *min_it < _min) _min = *min_it;
+  if (_values.empty() || *max_it > _max) _max = *max_it;
+
+  if constexpr (std::is_same<T, std::string>::value) {
+    auto character_count = size_t{0};
+    for (auto value_it = begin; value_it != begin + count; ++value_it) character_count += value_it->size();
+    _values.reserve(_values.size() + count, _values.data_size() + character_count);
+    for (auto value_it = begin; value_it != begin + count; ++value_it) _values.push_back(*value_it);
+  } else {
+    _values.insert(_values.end(), std::make_move_iterator(begin), std::make_move_iterator(begin + count));
+  }
+}
+
+template <typename T>
+size_t ValueSegment<T>::estimate_memory_usage() const {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return sizeof(*this) + _values.estimate_memory_usage();
+  } else {
+    return sizeof(*this) + estimate_values_memory_usage(_values);
+  }
 }
 
 template <typename T>
@@ -34,7 +78,18 @@ size_t ValueSegment<T>::size() const {
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+SegmentType ValueSegment<T>::segment_type() const {
+  return SegmentType::Value;
+}
+
+template <typename T>
+std::optional<ZoneMap> ValueSegment<T>::zone_map() const {
+  if (_values.empty()) return std::nullopt;
+  return ZoneMap{_min, _max};
+}
+
+template <typename T>
+const ValueVector<T>& ValueSegment<T>::values() const {
   return _values;
 }
 
@@ -1,19 +1,31 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "string_heap.hpp"
 
 namespace opossum {
 
+// Strings are kept in a StringHeap, all other types in a plain vector. Both offer size(), operator[], and iterators.
+// For strings, these return std::string_views.
+template <typename T>
+using ValueVector = std::conditional_t<std::is_same<T, std::string>::value, StringHeap, pmr_vector<T>>;
+
 // ValueSegment is a segment type that stores all its values in a vector
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
-  ValueSegment();
+  // the values are allocated through the given allocator, e.g., from the memory resource of a table
+  explicit ValueSegment(const PolymorphicAllocator<T>& allocator = {});
+
+  // creates a segment that takes over the given values, e.g., when loading a table
+  explicit ValueSegment(ValueVector<T>&& values);
 
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t offset) const override;
@@ -21,16 +33,29 @@ class ValueSegment : public BaseSegment {
   // add a value to the end
   void append(const AllTypeVariant& val) override;
 
+  // Adds values[offset] to values[offset + count - 1] to the end by moving them out of the given vector. This avoids
+  // the AllTypeVariant and type_cast per value of append(). Strings are copied into the StringHeap.
+  void append_values(std::vector<T>&& values, const size_t offset, const size_t count);
+
   // return the number of entries
   size_t size() const override;
 
+  SegmentType segment_type() const override;
+
+  // the zone map is maintained on every append
+  std::optional<ZoneMap> zone_map() const override;
+
+  size_t estimate_memory_usage() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const ValueVector<T>& values() const;
 
  protected:
-  std::vector<T> _values;
+  ValueVector<T> _values;
+  T _min{};
+  T _max{};
 };
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -53,8 +54,28 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// Encodings that can be chosen when compressing a chunk, see Table::compress_chunk
+enum class EncodingType { Dictionary, RunLength, FrameOfReference, Delta };
+
+// The concrete class of a segment, see BaseSegment::segment_type and resolve_segment_type
+enum class SegmentType { Value, Dictionary, RunLength, FrameOfReference, Delta, Reference };
+
+// The order of the values of a segment, see Chunk::sorted_by
+enum class SortMode { Ascending, Descending };
+
+// The kind of an index on segments of a chunk, see BaseIndex
+enum class SegmentIndexType { GroupKey, AdaptiveRadixTree };
+
 using PosList = std::vector<RowID>;
 
+// Segments and attribute vectors allocate their data through a polymorphic allocator, so that, e.g., a table can place
+// all of its values in an arena (see Table::Table).
+template <typename T>
+using PolymorphicAllocator = std::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::pmr::vector<T>;
+
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
  protected:
@@ -0,0 +1,580 @@
+#include "binary_table.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_segment_type.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/chunk.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/simd_bp128_attribute_vector.hpp"
+#include "storage/string_heap.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr std::array<char, 8> MAGIC = {'O', 'P', 'O', 'S', 'S', 'U', 'M', '\0'};
+constexpr uint32_t VERSION = 4;
+constexpr size_t ALIGNMENT = 8;
+
+static_assert(sizeof(size_t) == sizeof(uint64_t), "string end offsets are stored as u64");
+
+enum class SegmentEncoding : uint32_t {
+  Values = 0,
+  Dictionary = 1,
+  RunLength = 2,
+  FrameOfReference = 3,
+  Delta = 4,
+  SharedDictionary = 5
+};
+
+// states of the shared dictionary of a column, see Table::enable_shared_dictionary
+enum class SharedDictionaryState : uint32_t { Disabled = 0, Empty = 1, Stored = 2 };
+
+enum class AttributeVectorEncoding : uint32_t { Fitted = 0, BitPacked = 1, SimdBp128 = 2 };
+
+class BinaryWriter : private Noncopyable {
+ public:
+  explicit BinaryWriter(std::ostream& stream) : _stream(stream) {}
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be written");
+    _write_bytes(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  // arrays are aligned, so that they could be accessed in place
+  template <typename T>
+  void write_array(const T* values, const size_t count) {
+    static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values can be written");
+    static constexpr auto padding = std::array<char, ALIGNMENT>{};
+    _write_bytes(padding.data(), (ALIGNMENT - _offset % ALIGNMENT) % ALIGNMENT);
+    _write_bytes(reinterpret_cast<const char*>(values), count * sizeof(T));
+  }
+
+  void write_string(const std::string& value) {
+    write(static_cast<uint32_t>(value.size()));
+    write_array(value.data(), value.size());
+  }
+
+  void flush() {
+    _stream.flush();
+    Assert(!_stream.fail(), "write_binary_table: Could not write file");
+  }
+
+ protected:
+  std::ostream& _stream;
+  size_t _offset = 0;
+
+  void _write_bytes(const char* bytes, const size_t count) {
+    _stream.write(bytes, static_cast<std::streamsize>(count));
+    _offset += count;
+  }
+};
+
+class BinaryReader {
+ public:
+  BinaryReader(const char* data, const size_t size) : _data(data), _size(size) {}
+
+  template <typename T>
+  T read() {
+    Assert(sizeof(T) <= _size - _offset, "load_binary_table: file is truncated");
+    auto value = T{};
+    std::memcpy(&value, _data + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  // returns a pointer to the array within the mapped file
+  template <typename T>
+  const T* read_array(const size_t count) {
+    _offset = std::min(_size, (_offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+    Assert(count <= (_size - _offset) / sizeof(T), "load_binary_table: file is truncated");
+    const auto values = reinterpret_cast<const T*>(_data + _offset);
+    _offset += count * sizeof(T);
+    return values;
+  }
+
+  std::string read_string() {
+    const auto length = read<uint32_t>();
+    const auto characters = read_array<char>(length);
+    return std::string{characters, length};
+  }
+
+ protected:
+  const char* _data;
+  const size_t _size;
+  size_t _offset = 0;
+};
+
+// writes a u64 count followed by the elements of a vector
+template <typename Vector>
+void write_vector(BinaryWriter& writer, const Vector& vector) {
+  writer.write(uint64_t{vector.size()});
+  writer.write_array(vector.data(), vector.size());
+}
+
+// values is a ValueVector<T> or a std::vector<T>, see the value arrays in binary_table.hpp
+template <typename Values>
+void write_values(BinaryWriter& writer, const Values& values) {
+  if constexpr (std::is_same<Values, StringHeap>::value) {
+    writer.write(uint64_t{values.size()});
+    writer.write_array(values.end_offsets().data(), values.size());
+    write_vector(writer, values.characters());
+  } else if constexpr (std::is_same<typename Values::value_type, std::string>::value) {
+    auto string_heap = StringHeap{};
+    for (const auto& value : values) string_heap.push_back(value);
+    write_values(writer, string_heap);
+  } else {
+    write_vector(writer, values);
+  }
+}
+
+template <typename T>
+void write_dictionary(BinaryWriter& writer, const DictionaryType<T>& dictionary) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    writer.write(uint64_t{dictionary.size()});
+    write_vector(writer, dictionary.block_offsets());
+    write_vector(writer, dictionary.data());
+  } else {
+    write_values(writer, dictionary);
+  }
+}
+
+template <typename Width>
+bool write_fitted_attribute_vector(BinaryWriter& writer, const BaseAttributeVector& attribute_vector) {
+  const auto fitted_attribute_vector = dynamic_cast<const FittedAttributeVector<Width>*>(&attribute_vector);
+  if (!fitted_attribute_vector) return false;
+  writer.write(AttributeVectorEncoding::Fitted);
+  writer.write(uint64_t{attribute_vector.size()});
+  writer.write(static_cast<uint32_t>(sizeof(Width)));
+  write_vector(writer, fitted_attribute_vector->values());
+  return true;
+}
+
+void write_attribute_vector(BinaryWriter& writer, const BaseAttributeVector& attribute_vector) {
+  if (write_fitted_attribute_vector<uint8_t>(writer, attribute_vector) ||
+      write_fitted_attribute_vector<uint16_t>(writer, attribute_vector) ||
+      write_fitted_attribute_vector<uint32_t>(writer, attribute_vector)) {
+    return;
+  }
+
+  if (const auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    writer.write(AttributeVectorEncoding::BitPacked);
+    writer.write(uint64_t{attribute_vector.size()});
+    writer.write(uint32_t{bit_packed->bits_per_value()});
+    write_vector(writer, bit_packed->words());
+    return;
+  }
+
+  const auto simd_bp128 = dynamic_cast<const SimdBp128AttributeVector*>(&attribute_vector);
+  Assert(simd_bp128, "write_binary_table: unsupported attribute vector");
+  writer.write(AttributeVectorEncoding::SimdBp128);
+  writer.write(uint64_t{attribute_vector.size()});
+  writer.write(uint32_t{simd_bp128->bits_per_value()});
+  write_vector(writer, simd_bp128->words());
+}
+
+template <typename T>
+void write_zone_map(BinaryWriter& writer, const std::optional<ZoneMap>& zone_map) {
+  writer.write(uint32_t{zone_map.has_value()});
+  if (zone_map) {
+    writer.write(type_cast<T>(zone_map->min));
+    writer.write(type_cast<T>(zone_map->max));
+  }
+}
+
+// shared_dictionary is the dictionary that is shared by the segments of the column, or nullptr
+template <typename T>
+void write_segment(BinaryWriter& writer, const BaseSegment& segment,
+                   const std::shared_ptr<const void>& shared_dictionary) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentClass = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same<SegmentClass, ValueSegment<T>>::value) {
+      writer.write(SegmentEncoding::Values);
+      write_values(writer, typed_segment.values());
+    } else if constexpr (std::is_same<SegmentClass, DictionarySegment<T>>::value) {
+      // a shared dictionary is stored once for the column, not with each of its segments
+      if (shared_dictionary && typed_segment.dictionary() == shared_dictionary) {
+        writer.write(SegmentEncoding::SharedDictionary);
+      } else {
+        writer.write(SegmentEncoding::Dictionary);
+        write_dictionary<T>(writer, *typed_segment.dictionary());
+      }
+      writer.write(static_cast<ValueID::base_type>(typed_segment.min_value_id()));
+      writer.write(static_cast<ValueID::base_type>(typed_segment.max_value_id()));
+      write_attribute_vector(writer, *typed_segment.attribute_vector());
+    } else if constexpr (std::is_same<SegmentClass, RunLengthSegment<T>>::value) {
+      writer.write(SegmentEncoding::RunLength);
+      write_values(writer, *typed_segment.values());
+      write_vector(writer, *typed_segment.end_positions());
+    } else if constexpr (std::is_same<SegmentClass, ReferenceSegment>::value) {
+      // the referenced values are materialized, which goes through the slow operator[]
+      auto values = std::vector<T>();
+      values.reserve(segment.size());
+      for (size_t chunk_offset = 0; chunk_offset < segment.size(); ++chunk_offset) {
+        values.push_back(type_cast<T>(segment[chunk_offset]));
+      }
+      writer.write(SegmentEncoding::Values);
+      write_values(writer, values);
+    } else if constexpr (std::is_integral<T>::value &&
+                         std::is_same<SegmentClass, FrameOfReferenceSegment<T>>::value) {
+      writer.write(SegmentEncoding::FrameOfReference);
+      write_vector(writer, *typed_segment.block_minima());
+      writer.write(typed_segment.max_offset());
+      write_zone_map<T>(writer, typed_segment.zone_map());
+      write_attribute_vector(writer, *typed_segment.offsets());
+    } else if constexpr (std::is_integral<T>::value && std::is_same<SegmentClass, DeltaSegment<T>>::value) {
+      writer.write(SegmentEncoding::Delta);
+      write_vector(writer, *typed_segment.checkpoints());
+      writer.write(uint32_t{typed_segment.is_sorted()});
+      write_zone_map<T>(writer, typed_segment.zone_map());
+      write_attribute_vector(writer, *typed_segment.deltas());
+    } else {
+      Fail("write_binary_table: unsupported segment type");
+    }
+  });
+}
+
+// Reads a vector that has been written by write_vector with a single bulk copy. The vector owns its memory, so it
+// stays valid after the file is unmapped.
+template <typename Vector>
+Vector read_vector(BinaryReader& reader, const typename Vector::allocator_type& allocator = {}) {
+  const auto count = reader.read<uint64_t>();
+  const auto elements = reader.read_array<typename Vector::value_type>(count);
+  return Vector(elements, elements + count, allocator);
+}
+
+// Copies the values out of the mapped file. These are bulk copies, as the values are stored in the same layout as in
+// the segments.
+template <typename T>
+ValueVector<T> read_values(BinaryReader& reader, const PolymorphicAllocator<T>& allocator) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto count = reader.read<uint64_t>();
+    const auto end_offsets = reader.read_array<size_t>(count);
+    auto characters = read_vector<pmr_vector<char>>(reader, allocator);
+    Assert(std::is_sorted(end_offsets, end_offsets + count) &&
+               (count == 0 || end_offsets[count - 1] == characters.size()),
+           "load_binary_table: invalid string offsets");
+    return StringHeap{std::move(characters), pmr_vector<size_t>(end_offsets, end_offsets + count, allocator)};
+  } else {
+    return read_vector<pmr_vector<T>>(reader, allocator);
+  }
+}
+
+// reads values into a std::vector, which the encoded segments other than DictionarySegments use
+template <typename T>
+std::shared_ptr<std::vector<T>> read_std_values(BinaryReader& reader) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto string_heap = read_values<T>(reader, PolymorphicAllocator<T>{});
+    return std::make_shared<std::vector<T>>(string_heap.cbegin(), string_heap.cend());
+  } else {
+    return std::make_shared<std::vector<T>>(read_vector<std::vector<T>>(reader));
+  }
+}
+
+template <typename T>
+std::shared_ptr<const DictionaryType<T>> read_dictionary(BinaryReader& reader,
+                                                         const PolymorphicAllocator<T>& allocator) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    const auto size = reader.read<uint64_t>();
+    auto block_offsets = read_vector<pmr_vector<size_t>>(reader, allocator);
+    auto data = read_vector<pmr_vector<char>>(reader, allocator);
+    return std::make_shared<const FrontCodedDictionary>(std::move(data), std::move(block_offsets), size);
+  } else {
+    return std::make_shared<const DictionaryType<T>>(read_values<T>(reader, allocator));
+  }
+}
+
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(BinaryReader& reader,
+                                                           const PolymorphicAllocator<size_t>& allocator) {
+  const auto encoding = reader.read<AttributeVectorEncoding>();
+  const auto size = reader.read<uint64_t>();
+  auto attribute_vector = std::shared_ptr<BaseAttributeVector>{};
+  switch (encoding) {
+    case AttributeVectorEncoding::Fitted: {
+      switch (reader.read<uint32_t>()) {
+        case sizeof(uint8_t):
+          attribute_vector =
+              std::make_shared<FittedAttributeVector<uint8_t>>(read_vector<pmr_vector<uint8_t>>(reader, allocator));
+          break;
+        case sizeof(uint16_t):
+          attribute_vector =
+              std::make_shared<FittedAttributeVector<uint16_t>>(read_vector<pmr_vector<uint16_t>>(reader, allocator));
+          break;
+        case sizeof(uint32_t):
+          attribute_vector =
+              std::make_shared<FittedAttributeVector<uint32_t>>(read_vector<pmr_vector<uint32_t>>(reader, allocator));
+          break;
+        default:
+          Fail("load_binary_table: unsupported attribute vector width");
+      }
+      break;
+    }
+    case AttributeVectorEncoding::BitPacked: {
+      const auto bits_per_value = static_cast<uint8_t>(reader.read<uint32_t>());
+      attribute_vector = std::make_shared<BitPackedAttributeVector>(
+          size, bits_per_value, read_vector<pmr_vector<uint64_t>>(reader, allocator));
+      break;
+    }
+    case AttributeVectorEncoding::SimdBp128: {
+      const auto bits_per_value = static_cast<uint8_t>(reader.read<uint32_t>());
+      attribute_vector = std::make_shared<SimdBp128AttributeVector>(
+          size, bits_per_value, read_vector<pmr_vector<uint32_t>>(reader, allocator));
+      break;
+    }
+    default:
+      Fail("load_binary_table: unsupported attribute vector encoding");
+  }
+  Assert(attribute_vector->size() == size, "load_binary_table: attribute vector does not match its size");
+  return attribute_vector;
+}
+
+template <typename T>
+std::optional<ZoneMap> read_zone_map(BinaryReader& reader) {
+  if (reader.read<uint32_t>() == 0) return std::nullopt;
+  const auto min = reader.read<T>();
+  const auto max = reader.read<T>();
+  return ZoneMap{min, max};
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> read_segment(BinaryReader& reader, const uint32_t row_count,
+                                          const std::shared_ptr<const void>& shared_dictionary,
+                                          const PolymorphicAllocator<T>& allocator) {
+  auto segment = std::shared_ptr<BaseSegment>{};
+  const auto encoding = reader.read<SegmentEncoding>();
+  switch (encoding) {
+    case SegmentEncoding::Values: {
+      segment = std::make_shared<ValueSegment<T>>(read_values<T>(reader, allocator));
+      break;
+    }
+    case SegmentEncoding::Dictionary:
+    case SegmentEncoding::SharedDictionary: {
+      auto dictionary = std::shared_ptr<const DictionaryType<T>>{};
+      if (encoding == SegmentEncoding::SharedDictionary) {
+        Assert(shared_dictionary, "load_binary_table: segment refers to a missing shared dictionary");
+        dictionary = std::static_pointer_cast<const DictionaryType<T>>(shared_dictionary);
+      } else {
+        dictionary = read_dictionary<T>(reader, allocator);
+      }
+      const auto min_value_id = ValueID{reader.read<ValueID::base_type>()};
+      const auto max_value_id = ValueID{reader.read<ValueID::base_type>()};
+      segment = std::make_shared<DictionarySegment<T>>(dictionary, read_attribute_vector(reader, allocator),
+                                                       min_value_id, max_value_id);
+      break;
+    }
+    case SegmentEncoding::RunLength: {
+      const auto values = read_std_values<T>(reader);
+      const auto end_positions =
+          std::make_shared<std::vector<ChunkOffset>>(read_vector<std::vector<ChunkOffset>>(reader));
+      Assert(values->size() == end_positions->size() && std::is_sorted(end_positions->cbegin(), end_positions->cend()),
+             "load_binary_table: invalid runs");
+      segment = std::make_shared<RunLengthSegment<T>>(values, end_positions);
+      break;
+    }
+    case SegmentEncoding::FrameOfReference: {
+      if constexpr (std::is_integral<T>::value) {
+        const auto block_minima = read_std_values<T>(reader);
+        const auto max_offset = reader.read<uint32_t>();
+        const auto zone_map = read_zone_map<T>(reader);
+        const auto offsets = read_attribute_vector(reader, allocator);
+        Assert(block_minima->size() == (offsets->size() + FrameOfReferenceSegment<T>::BLOCK_SIZE - 1) /
+                                           FrameOfReferenceSegment<T>::BLOCK_SIZE,
+               "load_binary_table: invalid frame-of-reference blocks");
+        segment = std::make_shared<FrameOfReferenceSegment<T>>(block_minima, offsets, max_offset, zone_map);
+      } else {
+        Fail("load_binary_table: FrameOfReferenceSegments only hold integral values");
+      }
+      break;
+    }
+    case SegmentEncoding::Delta: {
+      if constexpr (std::is_integral<T>::value) {
+        const auto checkpoints = read_std_values<T>(reader);
+        const auto is_sorted = reader.read<uint32_t>() != 0;
+        const auto zone_map = read_zone_map<T>(reader);
+        const auto deltas = read_attribute_vector(reader, allocator);
+        Assert(checkpoints->size() == (deltas->size() + DeltaSegment<T>::CHECKPOINT_INTERVAL - 1) /
+                                          DeltaSegment<T>::CHECKPOINT_INTERVAL,
+               "load_binary_table: invalid delta checkpoints");
+        segment = std::make_shared<DeltaSegment<T>>(checkpoints, deltas, is_sorted, zone_map);
+      } else {
+        Fail("load_binary_table: DeltaSegments only hold integral values");
+      }
+      break;
+    }
+    default:
+      Fail("load_binary_table: unsupported segment encoding");
+  }
+  Assert(segment->size() == row_count, "load_binary_table: segment does not match the row count of its chunk");
+  return segment;
+}
+
+void write_chunk(BinaryWriter& writer, const std::vector<std::shared_ptr<BaseSegment>>& segments,
+                 const std::vector<std::string>& column_types,
+                 const std::vector<std::shared_ptr<const void>>& shared_dictionaries) {
+  DebugAssert(segments.size() == column_types.size(), "write_binary_table: one segment per column is needed");
+  writer.write(segments.empty() ? uint32_t{0} : static_cast<uint32_t>(segments.front()->size()));
+  for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      write_segment<ColumnDataType>(writer, *segments[column_id], shared_dictionaries[column_id]);
+    });
+  }
+}
+
+std::vector<std::shared_ptr<BaseSegment>> read_chunk(
+    BinaryReader& reader, const std::vector<std::string>& column_types,
+    const std::vector<std::shared_ptr<const void>>& shared_dictionaries, std::pmr::memory_resource* memory_resource) {
+  const auto allocator = PolymorphicAllocator<size_t>{memory_resource};
+  const auto row_count = reader.read<uint32_t>();
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>();
+  for (auto column_id = ColumnID{0}; column_id < column_types.size(); ++column_id) {
+    resolve_data_type(column_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      segments.push_back(read_segment<ColumnDataType>(reader, row_count, shared_dictionaries[column_id], allocator));
+    });
+  }
+  return segments;
+}
+
+}  // namespace
+
+void write_binary_chunk(std::ostream& stream, const std::vector<std::shared_ptr<BaseSegment>>& segments,
+                        const std::vector<std::string>& column_types,
+                        const std::vector<std::shared_ptr<const void>>& shared_dictionaries) {
+  auto writer = BinaryWriter{stream};
+  write_chunk(writer, segments, column_types, shared_dictionaries);
+  writer.flush();
+}
+
+std::vector<std::shared_ptr<BaseSegment>> read_binary_chunk(
+    const char* data, const size_t size, const std::vector<std::string>& column_types,
+    const std::vector<std::shared_ptr<const void>>& shared_dictionaries, std::pmr::memory_resource* memory_resource) {
+  auto reader = BinaryReader{data, size};
+  return read_chunk(reader, column_types, shared_dictionaries, memory_resource);
+}
+
+void write_binary_table(const Table& table, const std::string& file_name) {
+  auto stream = std::ofstream{file_name, std::ios::binary | std::ios::trunc};
+  Assert(stream.is_open(), "write_binary_table: Could not open file " + file_name);
+  auto writer = BinaryWriter{stream};
+  writer.write(MAGIC);
+  writer.write(VERSION);
+  writer.write(table.chunk_size());
+  writer.write(static_cast<uint32_t>(table.column_count()));
+  writer.write(static_cast<uint32_t>(table.chunk_count()));
+
+  auto shared_dictionaries = std::vector<std::shared_ptr<const void>>();
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    writer.write_string(table.column_name(column_id));
+    writer.write_string(table.column_type(column_id));
+
+    shared_dictionaries.push_back(table.shared_dictionary(column_id));
+    if (!table.has_shared_dictionary(column_id)) {
+      writer.write(SharedDictionaryState::Disabled);
+    } else if (!shared_dictionaries.back()) {
+      writer.write(SharedDictionaryState::Empty);
+    } else {
+      writer.write(SharedDictionaryState::Stored);
+      resolve_data_type(table.column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        write_dictionary<ColumnDataType>(
+            writer, *std::static_pointer_cast<const DictionaryType<ColumnDataType>>(shared_dictionaries.back()));
+      });
+    }
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    auto segments = std::vector<std::shared_ptr<BaseSegment>>();
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      segments.push_back(chunk.get_segment(column_id));
+    }
+    write_chunk(writer, segments, table.column_types(), shared_dictionaries);
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      const auto sort_mode = chunk.sorted_by(column_id);
+      writer.write(sort_mode ? static_cast<uint32_t>(*sort_mode) + 1 : uint32_t{0});
+    }
+  }
+
+  stream.close();
+  Assert(!stream.fail(), "write_binary_table: Could not write file " + file_name);
+}
+
+std::shared_ptr<Table> load_binary_table(const std::string& file_name, std::pmr::memory_resource* memory_resource) {
+  const auto file = MappedFile{file_name};
+  auto reader = BinaryReader{file.data(), file.size()};
+
+  Assert(reader.read<std::array<char, 8>>() == MAGIC, "load_binary_table: " + file_name + " is not a binary table");
+  Assert(reader.read<uint32_t>() == VERSION, "load_binary_table: unsupported version of " + file_name);
+  const auto chunk_size = reader.read<uint32_t>();
+  const auto column_count = reader.read<uint32_t>();
+  const auto chunk_count = reader.read<uint32_t>();
+
+  auto table = std::make_shared<Table>(chunk_size, memory_resource);
+  auto shared_dictionaries = std::vector<std::shared_ptr<const void>>();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto column_name = reader.read_string();
+    auto column_type = reader.read_string();
+    table->add_column_definition(column_name, column_type);
+
+    shared_dictionaries.emplace_back();
+    switch (reader.read<SharedDictionaryState>()) {
+      case SharedDictionaryState::Disabled:
+        break;
+      case SharedDictionaryState::Empty:
+        table->enable_shared_dictionary(column_id);
+        break;
+      case SharedDictionaryState::Stored:
+        resolve_data_type(column_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          shared_dictionaries.back() =
+              read_dictionary<ColumnDataType>(reader, PolymorphicAllocator<ColumnDataType>{memory_resource});
+        });
+        table->set_shared_dictionary(column_id, shared_dictionaries.back());
+        break;
+      default:
+        Fail("load_binary_table: unsupported shared dictionary state");
+    }
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto chunk = Chunk();
+    for (const auto& segment : read_chunk(reader, table->column_types(), shared_dictionaries, memory_resource)) {
+      chunk.add_segment(segment);
+    }
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto sort_mode = reader.read<uint32_t>();
+      if (sort_mode != 0) chunk.set_sorted_by(column_id, static_cast<SortMode>(sort_mode - 1));
+    }
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  return table;
+}
+
+}  // namespace opossum
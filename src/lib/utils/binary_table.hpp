@@ -0,0 +1,70 @@
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class BaseSegment;
+class Table;
+
+// Binary, columnar table files. Each segment is stored in its encoded form, with the same arrays as in memory, so that
+// loading it does not decode or re-encode anything: the file is mapped into memory and each array is restored by a
+// single bulk copy into the table's memory resource.
+//
+// Loading is not zero-copy: the segments do not point into the mapping. Their arrays are pmr_vectors that own their
+// memory, and ValueSegments are appended to, so they cannot use the read-only pages of a file. Each array is copied
+// once instead, which is bound by memory bandwidth rather than by parsing. In exchange, loaded tables do not depend on
+// the file, which may be overwritten or deleted right after loading (e.g., by StorageManager::save_snapshot).
+//
+// Layout (all numbers in native byte order, all arrays aligned to 8 bytes):
+//   header:  magic "OPOSSUM\0", u32 version, u32 chunk size, u32 column count, u32 chunk count
+//   columns: per column its name and its type, each as u32 length followed by the characters, and a u32 state of its
+//            shared dictionary (0 if it is not enabled, 1 if it has no dictionary yet, 2 if it is followed by the
+//            dictionary, see Table::enable_shared_dictionary)
+//   chunks:  per chunk a u32 row count, followed by one segment block per column and one u32 sort mode per column
+//            (0 if the column is not known to be sorted, 1 + SortMode otherwise, see Chunk::sorted_by)
+//
+// Segment blocks start with a u32 encoding:
+//   0 plain values:       the values as a value array
+//   1 dictionary:         the dictionary, the u32 smallest and biggest value id, and the value ids as attribute vector
+//   2 run length:         the value of each run as value array, and the u32 end position of each run as array
+//   3 frame of reference: the minimum of each block as array, the u32 biggest offset, the zone map, and the offsets as
+//                         attribute vector
+//   4 delta:              the checkpoints as array, a u32 that is 1 if the values are sorted, the zone map, and the
+//                         deltas as attribute vector
+//   5 shared dictionary:  like dictionary, but without the dictionary, which is the shared one of the column
+// An array is a u64 count followed by the raw elements. A value array is an array of the values. For strings, it is a
+// u64 count, the u64 end offset of each string, and the characters as array. String dictionaries are front coded
+// (see FrontCodedDictionary) and stored as a u64 string count, the block offsets as array, and the data as array, all
+// other dictionaries as value array. Zone maps are a u32 that is 1 if there is one, followed by the smallest and the
+// biggest value.
+// Attribute vectors start with a u32 encoding (0 fitted, 1 bit-packed, 2 SIMD-BP128) and the u64 number of value
+// ids. Fitted ones continue with a u32 width in bytes and the value ids as array, the others with the u32 number of
+// bits per value id and the packed words as array.
+//
+// ReferenceSegments are stored as the plain values they refer to.
+void write_binary_table(const Table& table, const std::string& file_name);
+
+// Loads a table that has been written by write_binary_table. The segments are allocated from the given memory resource
+// and do not keep the file mapped.
+std::shared_ptr<Table> load_binary_table(const std::string& file_name,
+                                         std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+// Writes the segments of a single chunk (one per column) in the layout of a chunk in binary table files, e.g., to spill
+// the chunk to disk. DictionarySegments that use the given dictionary of their column (a DictionaryType<T>, or
+// nullptr) are written without it, as shared dictionary segments.
+void write_binary_chunk(std::ostream& stream, const std::vector<std::shared_ptr<BaseSegment>>& segments,
+                        const std::vector<std::string>& column_types,
+                        const std::vector<std::shared_ptr<const void>>& shared_dictionaries);
+
+// Reads the segments of a chunk that has been written by write_binary_chunk with the same shared dictionaries. The
+// data has to be aligned to 8 bytes.
+std::vector<std::shared_ptr<BaseSegment>> read_binary_chunk(
+    const char* data, size_t size, const std::vector<std::string>& column_types,
+    const std::vector<std::shared_ptr<const void>>& shared_dictionaries, std::pmr::memory_resource* memory_resource);
+
+}  // namespace opossum
@@ -1,34 +1,166 @@
 #include "load_table.hpp"
 
-#include <fstream>
+#include <algorithm>
+#include <charconv>
+#include <deque>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
 
 namespace opossum {
 
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  std::ifstream infile(file_name);
-  Assert(infile.is_open(), "load_table: Could not find file " + file_name);
+namespace {
 
-  std::string line;
-  std::getline(infile, line);
-  std::vector<std::string> column_names = _split<std::string>(line, '|');
-  std::getline(infile, line);
-  std::vector<std::string> column_types = _split<std::string>(line, '|');
+// A range of rows (including their line breaks) that make up one chunk
+struct ChunkRows {
+  std::string_view rows;
+  size_t row_count;
+};
 
-  std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
+// Parses the values of one column directly into the data type of the column, without going through AllTypeVariant and
+// lexical_cast, and turns them into a ValueSegment
+class BaseColumnParser : private Noncopyable {
+ public:
+  virtual ~BaseColumnParser() = default;
+
+  virtual void parse(const std::string_view field) = 0;
+
+  virtual std::shared_ptr<BaseSegment> finish() = 0;
+};
+
+template <typename T>
+class ColumnParser : public BaseColumnParser {
+ public:
+  explicit ColumnParser(const size_t row_count) {
+    if constexpr (std::is_same<T, std::string>::value) {
+      _values.reserve(row_count, 0);
+    } else {
+      _values.reserve(row_count);
+    }
+  }
+
+  void parse(const std::string_view field) override {
+    if constexpr (std::is_same<T, std::string>::value) {
+      _values.push_back(field);
+    } else {
+      auto value = T{};
+      const auto field_end = field.data() + field.size();
+      const auto [parse_end, error] = std::from_chars(field.data(), field_end, value);
+      Assert(error == std::errc{} && parse_end == field_end, "load_table: Could not parse " + std::string{field});
+      _values.push_back(value);
+    }
+  }
+
+  std::shared_ptr<BaseSegment> finish() override { return std::make_shared<ValueSegment<T>>(std::move(_values)); }
+
+ protected:
+  ValueVector<T> _values;
+};
+
+// returns the next line without its line break and moves position behind it
+std::string_view next_line(const std::string_view data, size_t& position) {
+  const auto line_end = std::min(data.find('\n', position), data.size());
+  auto line = data.substr(position, line_end - position);
+  position = std::min(line_end + 1, data.size());
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  return line;
+}
+
+Chunk parse_chunk(const ChunkRows chunk_rows, const std::vector<std::string>& column_types) {
+  auto parsers = std::vector<std::unique_ptr<BaseColumnParser>>();
+  for (const auto& column_type : column_types) {
+    parsers.push_back(make_unique_by_data_type<BaseColumnParser, ColumnParser>(column_type, chunk_rows.row_count));
+  }
+
+  for (auto position = size_t{0}; position < chunk_rows.rows.size();) {
+    const auto line = next_line(chunk_rows.rows, position);
+    if (line.empty()) continue;
+
+    auto field_begin = size_t{0};
+    for (auto& parser : parsers) {
+      Assert(field_begin <= line.size(), "load_table: Too few values in line " + std::string{line});
+      const auto field_end = std::min(line.find('|', field_begin), line.size());
+      parser->parse(line.substr(field_begin, field_end - field_begin));
+      field_begin = field_end + 1;
+    }
+    Assert(field_begin == line.size() + 1, "load_table: Too many values in line " + std::string{line});
+  }
+
+  auto chunk = Chunk();
+  for (auto& parser : parsers) {
+    chunk.add_segment(parser->finish());
+  }
+  return chunk;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size,
+                                  std::optional<EncodingType> encoding_type) {
+  const auto file = MappedFile{file_name};
+  const auto data = std::string_view{file.data(), file.size()};
+
+  auto position = size_t{0};
+  const auto column_names = _split<std::string>(std::string{next_line(data, position)}, '|');
+  const auto column_types = _split<std::string>(std::string{next_line(data, position)}, '|');
+  Assert(column_names.size() == column_types.size(), "load_table: Column names and types do not match");
+
+  auto table = std::make_shared<Table>(chunk_size);
   for (size_t i = 0; i < column_names.size(); i++) {
-    test_table->add_column(column_names[i], column_types[i]);
+    table->add_column(column_names[i], column_types[i]);
+  }
+
+  // Finding the line breaks is much cheaper than parsing, so the rows are split into chunks up front.
+  auto chunks_rows = std::vector<ChunkRows>();
+  while (position < data.size()) {
+    const auto chunk_begin = position;
+    auto row_count = size_t{0};
+    while (row_count < chunk_size && position < data.size()) {
+      if (!next_line(data, position).empty()) ++row_count;
+    }
+    chunks_rows.push_back(ChunkRows{data.substr(chunk_begin, position - chunk_begin), row_count});
+  }
+
+  // At most one chunk per core is parsed at a time, and the parsed chunks are added in order.
+  const auto max_parsing_chunks = std::max(size_t{1}, size_t{std::thread::hardware_concurrency()});
+  auto parsing_chunks = std::deque<std::future<Chunk>>();
+  auto compressions = std::vector<std::future<void>>();
+  auto next_chunk_index = size_t{0};
+  for (size_t chunk_index = 0; chunk_index < chunks_rows.size(); ++chunk_index) {
+    while (next_chunk_index < chunks_rows.size() && parsing_chunks.size() < max_parsing_chunks) {
+      parsing_chunks.push_back(
+          std::async(std::launch::async, parse_chunk, chunks_rows[next_chunk_index], std::cref(column_types)));
+      ++next_chunk_index;
+    }
+
+    table->emplace_chunk(parsing_chunks.front().get());
+    parsing_chunks.pop_front();
+
+    if (encoding_type && chunks_rows[chunk_index].row_count == chunk_size) {
+      const auto chunk_id = ChunkID{static_cast<uint32_t>(chunk_index)};
+      compressions.push_back(std::async(std::launch::async, [&table, chunk_id, encoding_type]() {
+        table->compress_chunk(chunk_id, *encoding_type);
+      }));
+    }
   }
 
-  while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
-    test_table->append(values);
+  for (auto& compression : compressions) {
+    compression.get();
   }
-  return test_table;
+  return table;
 }
 
 }  // namespace opossum
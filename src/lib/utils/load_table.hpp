@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "types.hpp"
+
 namespace opossum {
 
 class Table;
@@ -23,6 +26,10 @@ std::vector<T> _split(const std::string& str, char delimiter) {
 }
 
 // This is a helper method which is heavily used in our test suite
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
+// The file is mapped into memory and split into chunk-sized ranges of rows, which are then parsed in parallel by
+// typed parsers. The chunks are added to the table in order. If an encoding is given, each full chunk is compressed
+// while the following ones are still being parsed.
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size,
+                                  std::optional<EncodingType> encoding_type = std::nullopt);
 
 }  // namespace opossum
@@ -0,0 +1,39 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFile::MappedFile(const std::string& file_name) {
+  const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open file " + file_name);
+
+  struct stat file_stat {};
+  if (fstat(file_descriptor, &file_stat) == 0 && file_stat.st_size > 0) {
+    _size = static_cast<size_t>(file_stat.st_size);
+    _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  }
+  // the mapping stays valid after the file is closed
+  close(file_descriptor);
+  Assert(_data != MAP_FAILED && _data != nullptr, "Could not map file " + file_name);
+
+  // files are read front to back
+  madvise(_data, _size, MADV_SEQUENTIAL);
+}
+
+MappedFile::~MappedFile() {
+  if (_data != MAP_FAILED && _data != nullptr) munmap(_data, _size);
+}
+
+const char* MappedFile::data() const { return static_cast<const char*>(_data); }
+
+size_t MappedFile::size() const { return _size; }
+
+}  // namespace opossum
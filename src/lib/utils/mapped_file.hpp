@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a whole file into memory (read-only) for as long as the object lives. The operating system reads the file in
+// large blocks as it is accessed, without copying it into a buffer first.
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& file_name);
+
+  ~MappedFile();
+
+  const char* data() const;
+
+  size_t size() const;
+
+ protected:
+  void* _data = nullptr;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
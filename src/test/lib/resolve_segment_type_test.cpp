@@ -0,0 +1,74 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_segment_type.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class ResolveSegmentTypeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    for (auto value = 0; value < 4; ++value) _table->append({value});
+    _value_segment = _table->get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  }
+
+  // returns the segment type that resolve_segment_type passes on for the segment
+  template <typename T>
+  static SegmentType _resolve(const BaseSegment& segment) {
+    auto segment_type = std::optional<SegmentType>{};
+    resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+      using SegmentClass = std::decay_t<decltype(typed_segment)>;
+      if constexpr (std::is_same<SegmentClass, ValueSegment<T>>::value) segment_type = SegmentType::Value;
+      if constexpr (std::is_same<SegmentClass, DictionarySegment<T>>::value) segment_type = SegmentType::Dictionary;
+      if constexpr (std::is_same<SegmentClass, RunLengthSegment<T>>::value) segment_type = SegmentType::RunLength;
+      if constexpr (std::is_same<SegmentClass, FrameOfReferenceSegment<T>>::value) {
+        segment_type = SegmentType::FrameOfReference;
+      }
+      if constexpr (std::is_same<SegmentClass, DeltaSegment<T>>::value) segment_type = SegmentType::Delta;
+      if constexpr (std::is_same<SegmentClass, ReferenceSegment>::value) segment_type = SegmentType::Reference;
+    });
+    return *segment_type;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<BaseSegment> _value_segment;
+};
+
+TEST_F(ResolveSegmentTypeTest, SegmentTypes) {
+  EXPECT_EQ(_resolve<int32_t>(*_value_segment), SegmentType::Value);
+  EXPECT_EQ(_resolve<int32_t>(DictionarySegment<int32_t>{_value_segment}), SegmentType::Dictionary);
+  EXPECT_EQ(_resolve<int32_t>(RunLengthSegment<int32_t>{_value_segment}), SegmentType::RunLength);
+  EXPECT_EQ(_resolve<int32_t>(FrameOfReferenceSegment<int32_t>{_value_segment}), SegmentType::FrameOfReference);
+  EXPECT_EQ(_resolve<int32_t>(DeltaSegment<int32_t>{_value_segment}), SegmentType::Delta);
+
+  const auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, ChunkOffset{1}}});
+  EXPECT_EQ(_resolve<int32_t>(ReferenceSegment{_table, ColumnID{0}, pos_list}), SegmentType::Reference);
+}
+
+TEST_F(ResolveSegmentTypeTest, DataAndSegmentType) {
+  auto sum = 0;
+  resolve_data_and_segment_type("int", *_value_segment, [&](auto type, const auto& typed_segment) {
+    using Type = typename decltype(type)::type;
+    // the lambda is instantiated for all data types and segment types
+    if constexpr (std::is_same<Type, int32_t>::value &&
+                  std::is_same<std::decay_t<decltype(typed_segment)>, ValueSegment<Type>>::value) {
+      for (const auto value : typed_segment.values()) sum += value;
+    }
+  });
+  EXPECT_EQ(sum, 6);
+}
+
+TEST_F(ResolveSegmentTypeTest, DataTypeMismatch) {
+  EXPECT_THROW(resolve_segment_type<std::string>(*_value_segment, [](const auto&) {}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -13,6 +14,8 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/adaptive_radix_tree_index.hpp"
+#include "storage/group_key_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -98,6 +101,67 @@ class OperatorsTableScanTest : public BaseTest {
     ASSERT_EQ(expected.size(), 0u);
   }
 
+  // Scans a table with an index of the given type on each full chunk. The values of column a are (i * 7) % 50, those of
+  // column b are i.
+  template <typename Index>
+  void _expect_index_scans(const std::string& column_type, const bool compress) {
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", column_type);
+    table->add_column("b", "int");
+    for (int i = 0; i < 250; ++i) table->append({_cast_value((i * 7) % 50, column_type), i});
+
+    // the last chunk is not full, so it has no index
+    for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+      if (compress) table->compress_chunk(chunk_id);
+      table->get_chunk(chunk_id).create_index<Index>({ColumnID{0}});
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    table_wrapper->execute();
+
+    // selective scans use the index, the others scan the segments
+    const auto scans = std::vector<std::pair<ScanType, int>>{
+        {ScanType::OpEquals, 21},        {ScanType::OpEquals, 60},      {ScanType::OpLessThan, 3},
+        {ScanType::OpLessThanEquals, 3}, {ScanType::OpGreaterThan, 46}, {ScanType::OpGreaterThanEquals, 46},
+        {ScanType::OpGreaterThan, 10},   {ScanType::OpNotEquals, 21}};
+    for (const auto& [scan_type, search_value] : scans) {
+      auto expected = std::vector<AllTypeVariant>{};
+      for (int i = 0; i < 250; ++i) {
+        // strings compare differently than numbers
+        const auto value = _cast_value((i * 7) % 50, column_type);
+        const auto search = _cast_value(search_value, column_type);
+        const auto matches = (scan_type == ScanType::OpEquals && value == search) ||
+                             (scan_type == ScanType::OpNotEquals && !(value == search)) ||
+                             (scan_type == ScanType::OpLessThan && value < search) ||
+                             (scan_type == ScanType::OpLessThanEquals && !(search < value)) ||
+                             (scan_type == ScanType::OpGreaterThan && search < value) ||
+                             (scan_type == ScanType::OpGreaterThanEquals && !(value < search));
+        if (matches) expected.emplace_back(i);
+      }
+
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type,
+                                              _cast_value(search_value, column_type));
+      scan->execute();
+      ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
+
+      // the rows are in the order of the chunks
+      if (expected.empty()) continue;
+      const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(
+                                  scan->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0}))
+                                  ->pos_list();
+      EXPECT_TRUE(std::is_sorted(pos_list.cbegin(), pos_list.cend(), [](const auto& left, const auto& right) {
+        return std::tie(left.chunk_id, left.chunk_offset) < std::tie(right.chunk_id, right.chunk_offset);
+      }));
+    }
+  }
+
+  // converts an int to a value of the given column type
+  static AllTypeVariant _cast_value(const int value, const std::string& column_type) {
+    if (column_type == "string") return std::to_string(value);
+    if (column_type == "long") return int64_t{value};
+    return value;
+  }
+
   std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
 };
 
@@ -267,6 +331,139 @@ TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthColumn) {
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (int i = 0; i < 15; ++i) table->append({i / 3, 100 + i});
+
+  table->compress_chunk(ChunkID(0), EncodingType::RunLength);
+  table->compress_chunk(ChunkID(1), EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {106, 107, 108};
+  tests[ScanType::OpNotEquals] = {100, 101, 102, 103, 104, 105, 109, 110, 111, 112, 113, 114};
+  tests[ScanType::OpLessThan] = {100, 101, 102, 103, 104, 105};
+  tests[ScanType::OpLessThanEquals] = {100, 101, 102, 103, 104, 105, 106, 107, 108};
+  tests[ScanType::OpGreaterThan] = {109, 110, 111, 112, 113, 114};
+  tests[ScanType::OpGreaterThanEquals] = {106, 107, 108, 109, 110, 111, 112, 113, 114};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 2);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+
+    // scan the ReferenceSegments pointing to the RunLengthSegments
+    auto scan_on_references = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpEquals, 2);
+    scan_on_references->execute();
+
+    const auto expected = test.first == ScanType::OpEquals || test.first == ScanType::OpLessThanEquals ||
+                                  test.first == ScanType::OpGreaterThanEquals
+                              ? std::vector<AllTypeVariant>{106, 107, 108}
+                              : std::vector<AllTypeVariant>{};
+    ASSERT_COLUMN_EQ(scan_on_references->get_output(), ColumnID{1}, expected);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithZoneMaps) {
+  // time-ordered values, so that most chunks can be skipped or taken completely based on their zone maps
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (int i = 0; i < 45; ++i) table->append({i / 2, i});
+
+  // chunk 4 stays uncompressed
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  table->compress_chunk(ChunkID{2}, EncodingType::FrameOfReference);
+  table->compress_chunk(ChunkID{3});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  const auto scan_types = {ScanType::OpEquals,      ScanType::OpNotEquals,        ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    // search values below, at the bounds of, inside of, and above the chunks' value ranges
+    for (const auto search_value : {-1, 0, 4, 5, 7, 9, 10, 22, 23}) {
+      auto expected = std::vector<AllTypeVariant>{};
+      for (int i = 0; i < 45; ++i) {
+        const auto value = i / 2;
+        const auto matches = (scan_type == ScanType::OpEquals && value == search_value) ||
+                             (scan_type == ScanType::OpNotEquals && value != search_value) ||
+                             (scan_type == ScanType::OpLessThan && value < search_value) ||
+                             (scan_type == ScanType::OpLessThanEquals && value <= search_value) ||
+                             (scan_type == ScanType::OpGreaterThan && value > search_value) ||
+                             (scan_type == ScanType::OpGreaterThanEquals && value >= search_value);
+        if (matches) expected.emplace_back(i);
+      }
+
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanSortedSegments) {
+  // the values of columns a and c are sorted with many duplicates, ascending in the even and descending in the odd
+  // chunks
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  table->add_column("c", "string");
+  const auto value = [](const int i) { return (i / 10) % 2 == 0 ? (i % 10) / 3 : 3 - (i % 10) / 3; };
+  for (int i = 0; i < 45; ++i) table->append({value(i), i, std::to_string(value(i))});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto sort_mode = chunk_id % 2 == 0 ? SortMode::Ascending : SortMode::Descending;
+    table->get_chunk(chunk_id).set_sorted_by(ColumnID{0}, sort_mode);
+    table->get_chunk(chunk_id).set_sorted_by(ColumnID{2}, sort_mode);
+  }
+
+  // chunks 0 and 1 stay ValueSegments, zone maps cannot skip or take any of them
+  table->compress_chunk(ChunkID{2});
+  table->compress_chunk(ChunkID{3});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+
+  const auto scan_types = {ScanType::OpEquals,      ScanType::OpNotEquals,        ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {-1, 0, 1, 2, 3, 4}) {
+      auto expected = std::vector<AllTypeVariant>{};
+      for (int i = 0; i < 45; ++i) {
+        const auto matches = (scan_type == ScanType::OpEquals && value(i) == search_value) ||
+                             (scan_type == ScanType::OpNotEquals && value(i) != search_value) ||
+                             (scan_type == ScanType::OpLessThan && value(i) < search_value) ||
+                             (scan_type == ScanType::OpLessThanEquals && value(i) <= search_value) ||
+                             (scan_type == ScanType::OpGreaterThan && value(i) > search_value) ||
+                             (scan_type == ScanType::OpGreaterThanEquals && value(i) >= search_value);
+        if (matches) expected.emplace_back(i);
+      }
+
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+      scan->execute();
+      ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
+
+      auto string_scan =
+          std::make_shared<TableScan>(table_wrapper, ColumnID{2}, scan_type, std::to_string(search_value));
+      string_scan->execute();
+      ASSERT_COLUMN_EQ(string_scan->get_output(), ColumnID{1}, expected);
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithGroupKeyIndex) { _expect_index_scans<GroupKeyIndex>("int", true); }
+
+TEST_F(OperatorsTableScanTest, ScanWithAdaptiveRadixTreeIndex) {
+  _expect_index_scans<AdaptiveRadixTreeIndex>("long", false);
+  _expect_index_scans<AdaptiveRadixTreeIndex>("string", true);
+}
+
 TEST_F(OperatorsTableScanTest, Getters) {
   const auto column_id = ColumnID{0};
   const auto scan_type = ScanType::OpGreaterThanEquals;
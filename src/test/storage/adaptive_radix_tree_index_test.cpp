@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  template <typename T>
+  static std::shared_ptr<BaseSegment> _value_segment(const std::vector<T>& values) {
+    auto segment = std::make_shared<ValueSegment<T>>();
+    for (const auto& value : values) segment->append(value);
+    return segment;
+  }
+
+  // compares the positions and the bounds of the index with those found by sorting the values
+  template <typename T>
+  static void _expect_bounds(const std::shared_ptr<BaseSegment>& segment, const std::vector<T>& values,
+                             const std::vector<T>& search_values) {
+    const auto index = AdaptiveRadixTreeIndex({segment});
+
+    auto expected_positions = std::vector<ChunkOffset>(values.size());
+    std::iota(expected_positions.begin(), expected_positions.end(), ChunkOffset{0});
+    std::stable_sort(expected_positions.begin(), expected_positions.end(),
+                     [&](const auto left, const auto right) { return values[left] < values[right]; });
+    EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()), expected_positions);
+
+    for (const auto& search_value : search_values) {
+      const auto smaller_count = std::count_if(values.cbegin(), values.cend(), [&](const T& value) {
+        return value < search_value;
+      });
+      const auto not_greater_count = std::count_if(values.cbegin(), values.cend(), [&](const T& value) {
+        return !(search_value < value);
+      });
+      EXPECT_EQ(std::distance(index.cbegin(), index.lower_bound({search_value})), smaller_count) << search_value;
+      EXPECT_EQ(std::distance(index.cbegin(), index.upper_bound({search_value})), not_greater_count) << search_value;
+    }
+  }
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, IntegerValues) {
+  // enough distinct values for all node sizes, with duplicates and negative values
+  auto values = std::vector<int64_t>();
+  for (auto row = int64_t{0}; row < 3000; ++row) values.push_back(((row * 7919) % 1000 - 500) * 100'003);
+  values.push_back(std::numeric_limits<int64_t>::min());
+  values.push_back(std::numeric_limits<int64_t>::max());
+
+  const auto search_values = std::vector<int64_t>{std::numeric_limits<int64_t>::min(), -50'001'500, -100'003, -1, 0,
+                                                  1, 100'003, 200'006, 49'901'497, std::numeric_limits<int64_t>::max()};
+  _expect_bounds(_value_segment(values), values, search_values);
+
+  const auto int_values = std::vector<int32_t>({3, -2, 0, 3, 70000, -70000, 255, 256});
+  _expect_bounds(_value_segment(int_values), int_values,
+                 std::vector<int32_t>({-70001, -2, -1, 0, 3, 255, 256, 1 << 30}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, FloatingPointValues) {
+  const auto values = std::vector<double>({1.5, -0.25, 0.0, -1e300, 1e-300, 2.0, -0.0, -0.25, 1e300});
+  _expect_bounds(_value_segment(values), values, std::vector<double>({-1e301, -0.25, -0.1, 0.0, -0.0, 1.0, 1e300}));
+
+  const auto float_values = std::vector<float>({0.5f, -3.0f, 0.25f, -0.5f});
+  _expect_bounds(_value_segment(float_values), float_values, std::vector<float>({-3.0f, -1.0f, 0.0f, 0.5f, 1.0f}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, StringValues) {
+  // keys with common prefixes, keys that are prefixes of others, and 0 bytes
+  auto values = std::vector<std::string>({"customer#1042", "customer#10", "customer#1", "customer#", "", "c",
+                                          "customer#1042", std::string("a\0b", 3), "a", std::string("a\0", 2), "b"});
+  for (auto id = 0; id < 300; ++id) values.push_back("customer#" + std::to_string(id * 37 % 300));
+
+  const auto search_values =
+      std::vector<std::string>({"", std::string("a\0", 2), std::string("a\0a", 3), "a", "aa", "customer#",
+                                "customer#10", "customer#100", "customer#1042", "customer#2", "d"});
+  _expect_bounds(_value_segment(values), values, search_values);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, DictionarySegment) {
+  auto values = std::vector<std::string>();
+  for (auto id = 0; id < 1000; ++id) values.push_back("customer#" + std::to_string(id * 7 % 500));
+  const auto segment = std::make_shared<DictionarySegment<std::string>>(_value_segment(values));
+
+  _expect_bounds(segment, values,
+                 std::vector<std::string>({"a", "customer#0", "customer#1", "customer#250", "customer#499", "z"}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, EmptySegment) {
+  const auto index = AdaptiveRadixTreeIndex({_value_segment(std::vector<int32_t>{})});
+  EXPECT_EQ(index.cbegin(), index.cend());
+  EXPECT_EQ(index.lower_bound({1}), index.cend());
+  EXPECT_EQ(index.upper_bound({1}), index.cend());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, ChunkIndexes) {
+  const auto segment = _value_segment(std::vector<int64_t>({5, 3, 4}));
+  auto chunk = Chunk{};
+  chunk.add_segment(segment);
+  const auto index = chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  EXPECT_EQ(index->type(), SegmentIndexType::AdaptiveRadixTree);
+  EXPECT_EQ(chunk.get_index(SegmentIndexType::AdaptiveRadixTree, {ColumnID{0}}), index);
+  EXPECT_EQ(chunk.get_index(SegmentIndexType::GroupKey, {ColumnID{0}}), nullptr);
+
+  // the index does not cover appended values
+  chunk.append({int64_t{1}});
+  EXPECT_EQ(chunk.get_index(SegmentIndexType::AdaptiveRadixTree, {ColumnID{0}}), nullptr);
+
+  EXPECT_THROW(AdaptiveRadixTreeIndex({std::make_shared<RunLengthSegment<int64_t>>(segment)}), std::logic_error);
+}
+
+}  // namespace opossum
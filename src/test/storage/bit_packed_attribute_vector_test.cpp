@@ -0,0 +1,95 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../../lib/storage/fitted_attribute_vector.hpp"
+#include "../../lib/storage/simd_bp128_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public ::testing::Test {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, GetSet) {
+  auto vec = BitPackedAttributeVector(5, ValueID(50));
+  vec.set(0, ValueID(4));
+  vec.set(3, ValueID(50));
+  vec.set(4, ValueID(1));
+
+  EXPECT_EQ(vec.get(0), 4u);
+  EXPECT_EQ(vec.get(1), 0u);
+  EXPECT_EQ(vec.get(3), 50u);
+  EXPECT_EQ(vec.get(4), 1u);
+
+  EXPECT_THROW(vec.set(1, ValueID(128)), std::logic_error);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, ValuesSpanningWords) {
+  // 9 bits per value, so that many value ids are stored across two 64-bit words
+  auto vec = BitPackedAttributeVector(300, ValueID(299));
+  for (size_t index = 0; index < vec.size(); ++index) {
+    vec.set(index, ValueID{static_cast<uint32_t>(299 - index)});
+  }
+
+  for (size_t index = 0; index < vec.size(); ++index) {
+    EXPECT_EQ(vec.get(index), ValueID{static_cast<uint32_t>(299 - index)});
+  }
+
+  // overwriting a value must not affect its neighbours
+  vec.set(7, ValueID(0));
+  EXPECT_EQ(vec.get(6), 293u);
+  EXPECT_EQ(vec.get(7), 0u);
+  EXPECT_EQ(vec.get(8), 291u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Size) {
+  const auto vec = BitPackedAttributeVector(5, ValueID(50));
+
+  EXPECT_EQ(vec.size(), 5u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Width) {
+  EXPECT_EQ(BitPackedAttributeVector(1, ValueID(0)).bits_per_value(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(1, ValueID(1)).bits_per_value(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(1, ValueID(299)).bits_per_value(), 9u);
+  EXPECT_EQ(BitPackedAttributeVector(1, ValueID(100000)).bits_per_value(), 17u);
+
+  EXPECT_EQ(BitPackedAttributeVector(1, ValueID(50)).width(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(1, ValueID(299)).width(), 2u);
+  EXPECT_EQ(BitPackedAttributeVector(1, ValueID(100000)).width(), 3u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Decode) {
+  auto vec = BitPackedAttributeVector(100, ValueID(99));
+  for (size_t index = 0; index < vec.size(); ++index) {
+    vec.set(index, ValueID{static_cast<uint32_t>(index)});
+  }
+
+  auto decoded = ValueIDBlock{};
+  EXPECT_EQ(vec.decode_block(45, decoded), 55u);
+  for (size_t index = 0; index < 55; ++index) {
+    EXPECT_EQ(decoded[index], ValueID{static_cast<uint32_t>(45 + index)});
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, MakeSharedCompressedAttributeVector) {
+  auto vec1 = make_shared_compressed_attribute_vector(5, ValueID(3));
+  EXPECT_NE(std::dynamic_pointer_cast<BitPackedAttributeVector>(vec1), nullptr);
+
+  auto vec2 = make_shared_compressed_attribute_vector(5, ValueID(255));
+  EXPECT_NE(std::dynamic_pointer_cast<FittedAttributeVector<uint8_t>>(vec2), nullptr);
+
+  auto vec3 = make_shared_compressed_attribute_vector(5, ValueID(300));
+  EXPECT_NE(std::dynamic_pointer_cast<BitPackedAttributeVector>(vec3), nullptr);
+
+  auto vec4 = make_shared_compressed_attribute_vector(5, ValueID(65535));
+  EXPECT_NE(std::dynamic_pointer_cast<FittedAttributeVector<uint16_t>>(vec4), nullptr);
+
+  // vectors spanning at least one full block are stored in the SIMD-BP128 layout
+  auto vec5 = make_shared_compressed_attribute_vector(ATTRIBUTE_VECTOR_BLOCK_SIZE, ValueID(300));
+  EXPECT_NE(std::dynamic_pointer_cast<SimdBp128AttributeVector>(vec5), nullptr);
+}
+
+}  // namespace opossum
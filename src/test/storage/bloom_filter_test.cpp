@@ -0,0 +1,80 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/bloom_filter.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto values = std::vector<int64_t>{};
+  for (auto value = int64_t{0}; value < 10000; ++value) values.push_back(value * 7);
+  const auto bloom_filter = make_bloom_filter(values);
+
+  for (const auto value : values) EXPECT_TRUE(bloom_filter->may_contain(bloom_filter_hash(value)));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  auto values = std::vector<std::string>{};
+  for (auto value = 0; value < 10000; ++value) values.push_back("key" + std::to_string(value));
+  const auto bloom_filter = make_bloom_filter(values);
+
+  // about 9.6 bits and 7 hash functions per value are needed for a false positive rate of 1%
+  EXPECT_GE(bloom_filter->bit_count(), 95000u);
+  EXPECT_EQ(bloom_filter->hash_function_count(), 7u);
+
+  auto false_positives = 0;
+  for (auto value = 0; value < 10000; ++value) {
+    if (bloom_filter->may_contain(bloom_filter_hash("other" + std::to_string(value)))) ++false_positives;
+  }
+  EXPECT_LT(false_positives, 300);
+}
+
+TEST_F(StorageBloomFilterTest, EmptyFilter) {
+  const auto bloom_filter = BloomFilter{0};
+  EXPECT_FALSE(bloom_filter.may_contain(bloom_filter_hash(17)));
+
+  EXPECT_THROW(BloomFilter(10, 0.0), std::logic_error);
+}
+
+TEST_F(StorageBloomFilterTest, CompressChunk) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("id", "int");
+  table->add_column("name", "string");
+  table->enable_bloom_filter(ColumnID{0});
+  for (auto value = 0; value < 1000; ++value) table->append({(value * 7919) % 1000, std::to_string(value)});
+  for (auto chunk_id = ChunkID{0}; chunk_id < 10; ++chunk_id) table->compress_chunk(chunk_id);
+
+  // only the enabled column gets Bloom filters
+  const auto& chunk = table->get_chunk(ChunkID{3});
+  ASSERT_NE(chunk.bloom_filter(ColumnID{0}), nullptr);
+  EXPECT_EQ(chunk.bloom_filter(ColumnID{1}), nullptr);
+  EXPECT_TRUE(chunk.bloom_filter(ColumnID{0})->may_contain(bloom_filter_hash((300 * 7919) % 1000)));
+
+  // compressing again keeps the Bloom filter
+  const auto bloom_filter = chunk.bloom_filter(ColumnID{0});
+  table->compress_chunk(ChunkID{3});
+  EXPECT_EQ(table->get_chunk(ChunkID{3}).bloom_filter(ColumnID{0}), bloom_filter);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  for (const auto search_value : {0, 17, 999}) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, search_value);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), 1u);
+  }
+
+  auto scan_missing = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 1000);
+  scan_missing->execute();
+  EXPECT_EQ(scan_missing->get_output()->row_count(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,236 @@
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/buffer_manager.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBufferManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto value = 0; value < 95; ++value) _table->append({value, std::to_string(value)});
+
+    // the number of bytes of the segments of a full chunk (all but the first one have strings with two characters)
+    const auto& chunk = _table->get_chunk(ChunkID{1});
+    _chunk_memory_usage = chunk.get_segment(ColumnID{0})->estimate_memory_usage() +
+                          chunk.get_segment(ColumnID{1})->estimate_memory_usage();
+  }
+
+  void TearDown() override { std::filesystem::remove(_spill_file_name); }
+
+  void _expect_values() const {
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      const auto& chunk = _table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        const auto value = static_cast<int32_t>(chunk_id * 10 + chunk_offset);
+        EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[chunk_offset], AllTypeVariant{value});
+        EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[chunk_offset], AllTypeVariant{std::to_string(value)});
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  size_t _chunk_memory_usage = 0;
+  const std::string _spill_file_name = "buffer_manager_test.spill";
+};
+
+TEST_F(StorageBufferManagerTest, EvictsChunksBeyondBudget) {
+  _table->enable_eviction(3 * _chunk_memory_usage, _spill_file_name);
+  const auto& buffer_manager = *_table->buffer_manager();
+  EXPECT_LE(buffer_manager.memory_usage(), 3 * _chunk_memory_usage);
+  EXPECT_TRUE(std::filesystem::exists(_spill_file_name));
+
+  auto resident_chunk_count = 0;
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    resident_chunk_count += buffer_manager.is_chunk_resident(chunk_id);
+  }
+  // three full chunks and the last chunk, which is still being appended to
+  EXPECT_EQ(resident_chunk_count, 4);
+
+  // sizes and zone maps of evicted chunks are known without loading them
+  EXPECT_FALSE(buffer_manager.is_chunk_resident(ChunkID{0}));
+  EXPECT_EQ(_table->row_count(), 95u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0}).zone_map(ColumnID{0})->max, AllTypeVariant{9});
+  EXPECT_FALSE(buffer_manager.is_chunk_resident(ChunkID{0}));
+
+  _expect_values();
+  EXPECT_LE(buffer_manager.memory_usage(), 3 * _chunk_memory_usage);
+}
+
+TEST_F(StorageBufferManagerTest, ReplacesChunksWithClock) {
+  _table->enable_eviction(0, _spill_file_name);
+  const auto& buffer_manager = *_table->buffer_manager();
+  EXPECT_EQ(buffer_manager.memory_usage(), 0u);
+
+  // the chunk that has just been loaded stays resident until another chunk is loaded
+  EXPECT_EQ((*_table->get_chunk(ChunkID{2}).get_segment(ColumnID{0}))[0], AllTypeVariant{20});
+  EXPECT_TRUE(buffer_manager.is_chunk_resident(ChunkID{2}));
+  EXPECT_EQ((*_table->get_chunk(ChunkID{5}).get_segment(ColumnID{0}))[0], AllTypeVariant{50});
+  EXPECT_FALSE(buffer_manager.is_chunk_resident(ChunkID{2}));
+  EXPECT_TRUE(buffer_manager.is_chunk_resident(ChunkID{5}));
+}
+
+TEST_F(StorageBufferManagerTest, SegmentsOutliveEviction) {
+  _table->enable_eviction(0, _spill_file_name);
+  const auto segment = _table->get_chunk(ChunkID{3}).get_segment(ColumnID{1});
+  _table->buffer_manager()->load_chunk(ChunkID{4});
+  EXPECT_FALSE(_table->buffer_manager()->is_chunk_resident(ChunkID{3}));
+  EXPECT_EQ((*segment)[9], AllTypeVariant{"39"});
+}
+
+TEST_F(StorageBufferManagerTest, CompressEvictedChunk) {
+  _table->enable_eviction(0, _spill_file_name);
+  _table->compress_chunk(ChunkID{1});
+  _table->buffer_manager()->load_chunk(ChunkID{0});
+  EXPECT_FALSE(_table->buffer_manager()->is_chunk_resident(ChunkID{1}));
+
+  // the compressed segments have been written to the spill file again
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+                _table->get_chunk(ChunkID{1}).get_segment(ColumnID{1})),
+            nullptr);
+  _expect_values();
+}
+
+TEST_F(StorageBufferManagerTest, EvictsCompressedChunksInTheirEncoding) {
+  auto table = Table{10};
+  table.add_column("a", "int");
+  table.add_column("b", "long");
+  for (auto value = 0; value < 45; ++value) table.append({value % 4, int64_t{value} * 3});
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  table.compress_chunk(ChunkID{2}, EncodingType::FrameOfReference);
+  table.compress_chunk(ChunkID{3}, EncodingType::Delta);
+  const auto segment_types = std::vector<SegmentType>{SegmentType::Dictionary, SegmentType::RunLength,
+                                                      SegmentType::FrameOfReference, SegmentType::Delta};
+
+  auto segments = std::vector<std::shared_ptr<BaseSegment>>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    segments.push_back(table.get_chunk(chunk_id).get_segment(ColumnID{1}));
+  }
+  table.enable_eviction(0, _spill_file_name);
+
+  // the chunks are loaded back in their encoding, so they use as much memory as before they were evicted
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    EXPECT_FALSE(table.buffer_manager()->is_chunk_resident(chunk_id));
+    const auto segment = table.get_chunk(chunk_id).get_segment(ColumnID{1});
+    EXPECT_NE(segment, segments[chunk_id]);
+    EXPECT_EQ(segment->segment_type(), segment_types[chunk_id]);
+    EXPECT_EQ(segment->estimate_memory_usage(), segments[chunk_id]->estimate_memory_usage());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+      EXPECT_EQ((*segment)[chunk_offset], (*segments[chunk_id])[chunk_offset]);
+    }
+  }
+}
+
+TEST_F(StorageBufferManagerTest, EvictsSegmentsWithSharedDictionary) {
+  _table->enable_shared_dictionary(ColumnID{1});
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+  const auto memory_usage = _table->get_chunk(ChunkID{1}).get_segment(ColumnID{1})->estimate_memory_usage();
+  _table->enable_eviction(0, _spill_file_name);
+
+  // the segments refer to the shared dictionary again instead of a copy of it
+  const auto segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      _table->get_chunk(ChunkID{1}).get_segment(ColumnID{1}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->dictionary(), _table->shared_dictionary(ColumnID{1}));
+  EXPECT_EQ(segment->estimate_memory_usage(), memory_usage);
+
+  // Compressing another chunk adds values to the dictionary. The evicted chunks are not loaded for that, but
+  // re-encoded with the new dictionary when they are loaded the next time.
+  _table->compress_chunk(ChunkID{2});
+  EXPECT_FALSE(_table->buffer_manager()->is_chunk_resident(ChunkID{0}));
+  EXPECT_FALSE(_table->buffer_manager()->is_chunk_resident(ChunkID{1}));
+  _table->buffer_manager()->evict_chunks();
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+        _table->get_chunk(chunk_id).get_segment(ColumnID{1}));
+    ASSERT_NE(dictionary_segment, nullptr);
+    EXPECT_EQ(dictionary_segment->dictionary(), _table->shared_dictionary(ColumnID{1}));
+  }
+  _expect_values();
+}
+
+TEST_F(StorageBufferManagerTest, KeepsChunksWithReferenceSegments) {
+  auto references = Table{10};
+  references.add_column_definition("a", "int");
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    auto pos_list = std::make_shared<PosList>();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10; ++chunk_offset) {
+      pos_list->push_back(RowID{chunk_id, chunk_offset});
+    }
+    auto chunk = Chunk{};
+    chunk.add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list));
+    references.emplace_chunk(std::move(chunk));
+  }
+
+  // ReferenceSegments could only be spilled as the values they refer to
+  references.enable_eviction(0, _spill_file_name);
+  EXPECT_TRUE(references.buffer_manager()->is_chunk_resident(ChunkID{0}));
+  EXPECT_EQ(references.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->segment_type(), SegmentType::Reference);
+  EXPECT_EQ((*references.get_chunk(ChunkID{1}).get_segment(ColumnID{0}))[3], AllTypeVariant{13});
+}
+
+TEST_F(StorageBufferManagerTest, PrefetchChunk) {
+  _table->enable_eviction(2 * _chunk_memory_usage, _spill_file_name);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    _table->prefetch_chunk(chunk_id);
+  }
+  _expect_values();
+  EXPECT_LE(_table->buffer_manager()->memory_usage(), 2 * _chunk_memory_usage);
+}
+
+TEST_F(StorageBufferManagerTest, ScanEvictedTable) {
+  _table->enable_eviction(_chunk_memory_usage, _spill_file_name);
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 42);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 53u);
+
+  // chunks that are ruled out by their zone maps are not loaded
+  EXPECT_FALSE(_table->buffer_manager()->is_chunk_resident(ChunkID{0}));
+}
+
+TEST_F(StorageBufferManagerTest, ScanDoesNotPrefetchSkippedChunks) {
+  // only the first chunk is resident
+  _table->enable_eviction(_chunk_memory_usage, _spill_file_name);
+  _table->buffer_manager()->load_chunk(ChunkID{0});
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 5u);
+
+  // All chunks but the first one are ruled out by their zone maps, so they are neither loaded nor prefetched.
+  // Prefetches run in the background, so a chunk that was prefetched might only become resident a little later.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  for (auto chunk_id = ChunkID{1}; chunk_id < 9; ++chunk_id) {
+    EXPECT_FALSE(_table->buffer_manager()->is_chunk_resident(chunk_id));
+  }
+}
+
+TEST_F(StorageBufferManagerTest, RemovesSpillFile) {
+  _table->enable_eviction(0, _spill_file_name);
+  EXPECT_THROW(_table->enable_eviction(0, _spill_file_name), std::logic_error);
+  _table = nullptr;
+  EXPECT_FALSE(std::filesystem::exists(_spill_file_name));
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <optional>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -6,6 +7,7 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -58,6 +60,45 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(base_segment->size(), 4u);
 }
 
+TEST_F(StorageChunkTest, ZoneMap) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  c.append({7, "a"});
+
+  EXPECT_EQ(c.zone_map(ColumnID{0})->min, AllTypeVariant{3});
+  EXPECT_EQ(c.zone_map(ColumnID{0})->max, AllTypeVariant{7});
+  EXPECT_EQ(c.zone_map(ColumnID{1})->min, AllTypeVariant{"!"});
+  EXPECT_EQ(c.zone_map(ColumnID{1})->max, AllTypeVariant{"world"});
+
+  auto empty_chunk = Chunk{};
+  empty_chunk.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>("int"));
+  EXPECT_FALSE(empty_chunk.zone_map(ColumnID{0}));
+
+  // compressed segments compute their zone maps when they are created
+  c.replace_segment(ColumnID{0}, make_shared_by_data_type<BaseSegment, DictionarySegment>("int", int_value_segment));
+  EXPECT_EQ(c.zone_map(ColumnID{0})->min, AllTypeVariant{3});
+  EXPECT_EQ(c.zone_map(ColumnID{0})->max, AllTypeVariant{7});
+}
+
+TEST_F(StorageChunkTest, SortedBy) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_EQ(c.sorted_by(ColumnID{0}), std::nullopt);
+
+  c.set_sorted_by(ColumnID{1}, SortMode::Descending);
+  EXPECT_EQ(c.sorted_by(ColumnID{1}), SortMode::Descending);
+
+  // the appended values might be out of order
+  c.append({2, "."});
+  EXPECT_EQ(c.sorted_by(ColumnID{1}), std::nullopt);
+
+  // the flag is kept when the segment is compressed
+  c.set_sorted_by(ColumnID{1}, SortMode::Descending);
+  c.replace_segment(ColumnID{1},
+                    make_shared_by_data_type<BaseSegment, DictionarySegment>("string", string_value_segment));
+  EXPECT_EQ(c.sorted_by(ColumnID{1}), SortMode::Descending);
+}
+
 TEST_F(StorageChunkTest, UnknownSegmentType) {
   // Exception will only be thrown in debug builds
   if (IS_DEBUG) {
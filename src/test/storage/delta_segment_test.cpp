@@ -0,0 +1,183 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/delta_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageDeltaSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageDeltaSegmentTest, CompressSegment) {
+  for (auto value : {1000, 1003, 1001, 1007}) vc_int->append(value);
+  auto segment = DeltaSegment<int32_t>(vc_int);
+
+  EXPECT_EQ(segment.size(), 4u);
+  EXPECT_FALSE(segment.is_sorted());
+  EXPECT_EQ(*segment.checkpoints(), std::vector<int32_t>({1000}));
+
+  // the deltas 3, -2, and 6 are zig-zag encoded
+  EXPECT_EQ(segment.deltas()->get(1), 6u);
+  EXPECT_EQ(segment.deltas()->get(2), 3u);
+  EXPECT_EQ(segment.deltas()->get(3), 12u);
+
+  EXPECT_EQ(segment.get(0), 1000);
+  EXPECT_EQ(segment.get(2), 1001);
+  EXPECT_EQ(segment[3], AllTypeVariant{1007});
+  EXPECT_EQ(segment.zone_map()->min, AllTypeVariant{1000});
+  EXPECT_EQ(segment.zone_map()->max, AllTypeVariant{1007});
+}
+
+TEST_F(StorageDeltaSegmentTest, Timestamps) {
+  // nearly monotonic timestamps, where each delta needs only a few bits
+  const auto row_count = 5 * DeltaSegment<int64_t>::CHECKPOINT_INTERVAL + 17;
+  for (auto index = int64_t{0}; index < row_count; ++index) vc_long->append(int64_t{1500000000000} + index * 3);
+  auto segment = DeltaSegment<int64_t>(vc_long);
+
+  EXPECT_TRUE(segment.is_sorted());
+  EXPECT_EQ(segment.checkpoints()->size(), 6u);
+  EXPECT_EQ(segment.deltas()->width(), 1u);
+
+  auto values = DeltaSegment<int64_t>::ValueBlock{};
+  EXPECT_EQ(segment.decode_block(5, values), 17u);
+  EXPECT_EQ(values[16], int64_t{1500000000000} + (row_count - 1) * 3);
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    ASSERT_EQ(segment.get(index), int64_t{1500000000000} + index * 3);
+  }
+}
+
+TEST_F(StorageDeltaSegmentTest, ExtremeValues) {
+  // differences wrap around, so the step from max to min is a delta of 1
+  for (auto value : {std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(), -5}) {
+    vc_int->append(value);
+  }
+  auto segment = DeltaSegment<int32_t>(vc_int);
+  EXPECT_EQ(segment.get(1), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(segment.get(2), -5);
+  EXPECT_EQ(segment.zone_map()->min, AllTypeVariant{std::numeric_limits<int32_t>::min()});
+
+  vc_long->append(0);
+  vc_long->append(int64_t{1} << 40);
+  EXPECT_FALSE(DeltaSegment<int64_t>::is_encodable(vc_long));
+  EXPECT_THROW(DeltaSegment<int64_t>{vc_long}, std::logic_error);
+}
+
+TEST_F(StorageDeltaSegmentTest, Outliers) {
+  // a nearly monotonic column with outliers, whose zig-zag encoded deltas take up all 32 bits
+  for (auto value : {0, std::numeric_limits<int32_t>::min(), 1, std::numeric_limits<int32_t>::max(), 2,
+                     std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 3}) {
+    vc_int->append(value);
+  }
+  EXPECT_TRUE(DeltaSegment<int32_t>::is_encodable(vc_int));
+  auto segment = DeltaSegment<int32_t>(vc_int);
+  EXPECT_EQ(segment.get(1), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(segment.get(3), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(segment.get(6), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(segment.get(7), 3);
+  EXPECT_FALSE(segment.is_sorted());
+}
+
+TEST_F(StorageDeltaSegmentTest, LowerUpperBound) {
+  // every value occurs twice: 0, 0, 2, 2, 4, 4, ...
+  for (auto index = 0; index < 1000; ++index) vc_int->append(index / 2 * 2);
+  auto segment = DeltaSegment<int32_t>(vc_int);
+
+  ASSERT_TRUE(segment.is_sorted());
+  EXPECT_EQ(segment.lower_bound(-5), 0u);
+  EXPECT_EQ(segment.lower_bound(0), 0u);
+  EXPECT_EQ(segment.upper_bound(0), 2u);
+  EXPECT_EQ(segment.lower_bound(256), 256u);
+  EXPECT_EQ(segment.upper_bound(256), 258u);
+  EXPECT_EQ(segment.lower_bound(257), 258u);
+  EXPECT_EQ(segment.upper_bound(257), 258u);
+  EXPECT_EQ(segment.upper_bound(998), 1000u);
+  EXPECT_EQ(segment.lower_bound(999), 1000u);
+
+  auto unsorted_segment = DeltaSegment<int32_t>(std::make_shared<ValueSegment<int32_t>>());
+  EXPECT_TRUE(unsorted_segment.is_sorted());
+  EXPECT_EQ(unsorted_segment.lower_bound(3), 0u);
+}
+
+TEST_F(StorageDeltaSegmentTest, CompressChunk) {
+  auto table = Table{2};
+  table.add_column("a", "string");
+  table.append({"x"});
+  table.append({"y"});
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}, EncodingType::Delta), std::logic_error);
+
+  // chunks whose neighbouring values are too far apart are dictionary encoded instead
+  auto long_table = Table{3};
+  long_table.add_column("a", "long");
+  long_table.append({int64_t{0}});
+  long_table.append({std::numeric_limits<int64_t>::min()});
+  long_table.append({std::numeric_limits<int64_t>::max()});
+  long_table.compress_chunk(ChunkID{0}, EncodingType::Delta);
+
+  const auto long_segment = long_table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_EQ(long_segment->segment_type(), SegmentType::Dictionary);
+  EXPECT_EQ((*long_segment)[1], AllTypeVariant{std::numeric_limits<int64_t>::min()});
+
+  auto int_table = Table{3};
+  int_table.add_column("a", "int");
+  int_table.append({0});
+  int_table.append({std::numeric_limits<int32_t>::min()});
+  int_table.append({std::numeric_limits<int32_t>::max()});
+  int_table.compress_chunk(ChunkID{0}, EncodingType::Delta);
+  EXPECT_EQ(int_table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->segment_type(), SegmentType::Delta);
+}
+
+TEST_F(StorageDeltaSegmentTest, TableScan) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto index = 0; index < 2000; ++index) table->append({index / 2 * 2, index});
+  // the second chunk stays uncompressed
+  table->compress_chunk(ChunkID{0}, EncodingType::Delta);
+
+  auto unsorted_table = std::make_shared<Table>(1000);
+  unsorted_table->add_column("a", "int");
+  unsorted_table->add_column("b", "int");
+  for (auto index = 0; index < 1000; ++index) unsorted_table->append({(index * 7) % 1000 / 2 * 2, index});
+  unsorted_table->compress_chunk(ChunkID{0}, EncodingType::Delta);
+
+  for (const auto& current_table : {table, unsorted_table}) {
+    auto table_wrapper = std::make_shared<TableWrapper>(current_table);
+    table_wrapper->execute();
+
+    const auto value_count = current_table->row_count();
+    auto expected_row_counts = std::vector<std::pair<ScanType, size_t>>{};
+    expected_row_counts.emplace_back(ScanType::OpEquals, 2);
+    expected_row_counts.emplace_back(ScanType::OpNotEquals, value_count - 2);
+    expected_row_counts.emplace_back(ScanType::OpLessThan, 500);
+    expected_row_counts.emplace_back(ScanType::OpLessThanEquals, 502);
+    expected_row_counts.emplace_back(ScanType::OpGreaterThan, value_count - 502);
+    expected_row_counts.emplace_back(ScanType::OpGreaterThanEquals, value_count - 500);
+    for (const auto& [scan_type, row_count] : expected_row_counts) {
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, 500);
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), row_count);
+
+      // the same scan on ReferenceSegments pointing to the DeltaSegments
+      auto all_rows = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, -1);
+      all_rows->execute();
+      auto scan_on_references = std::make_shared<TableScan>(all_rows, ColumnID{0}, scan_type, 500);
+      scan_on_references->execute();
+      EXPECT_EQ(scan_on_references->get_output()->row_count(), row_count);
+    }
+  }
+}
+
+}  // namespace opossum
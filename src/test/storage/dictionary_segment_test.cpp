@@ -1,11 +1,13 @@
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "../../lib/resolve_type.hpp"
 #include "../../lib/storage/base_segment.hpp"
 #include "../../lib/storage/dictionary_segment.hpp"
+#include "../../lib/storage/simd_bp128_attribute_vector.hpp"
 #include "../../lib/storage/value_segment.hpp"
 
 class StorageDictionarySegmentTest : public ::testing::Test {
@@ -70,3 +72,28 @@ TEST_F(StorageDictionarySegmentTest, Get) {
   EXPECT_EQ(dict_col->get(0), 4);
   EXPECT_EQ(dict_col->get(1), 2);
 }
+
+TEST_F(StorageDictionarySegmentTest, BitPacksAttributeVector) {
+  for (int i = 0; i < 300; ++i) vc_int->append(i);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
+
+  // 300 unique values need 9 bits instead of the 16 bits of a FittedAttributeVector<uint16_t>
+  auto attribute_vector =
+      std::dynamic_pointer_cast<const opossum::SimdBp128AttributeVector>(dict_col->attribute_vector());
+  ASSERT_NE(attribute_vector, nullptr);
+  EXPECT_EQ(attribute_vector->bits_per_value(), 9u);
+
+  for (int i = 0; i < 300; ++i) EXPECT_EQ(dict_col->get(i), i);
+}
+
+TEST_F(StorageDictionarySegmentTest, CompressOtherSegmentType) {
+  for (int i : {7, 3, 7, 1, 3}) vc_int->append(i);
+  auto dict_col = std::make_shared<opossum::DictionarySegment<int>>(vc_int);
+
+  // segments that are not ValueSegments are materialized first
+  auto recompressed_col = opossum::DictionarySegment<int>(dict_col);
+  EXPECT_EQ(recompressed_col.unique_values_count(), 3u);
+  EXPECT_EQ(*recompressed_col.dictionary(), opossum::pmr_vector<int>({1, 3, 7}));
+  for (size_t i = 0; i < vc_int->size(); ++i) EXPECT_EQ(recompressed_col.get(i), vc_int->values()[i]);
+}
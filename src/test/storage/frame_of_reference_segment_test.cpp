@@ -0,0 +1,170 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegment) {
+  for (auto value : {1000, 1003, 1001, 1007}) vc_int->append(value);
+  auto segment = FrameOfReferenceSegment<int32_t>(vc_int);
+
+  EXPECT_EQ(segment.size(), 4u);
+  EXPECT_EQ(*segment.block_minima(), std::vector<int32_t>({1000}));
+  EXPECT_EQ(segment.max_offset(), 7u);
+  EXPECT_EQ(segment.offsets()->get(1), 3u);
+
+  EXPECT_EQ(segment.get(0), 1000);
+  EXPECT_EQ(segment.get(1), 1003);
+  EXPECT_EQ(segment.get(3), 1007);
+  EXPECT_EQ(segment[2], AllTypeVariant{1001});
+  EXPECT_EQ(segment.zone_map()->min, AllTypeVariant{1000});
+  EXPECT_EQ(segment.zone_map()->max, AllTypeVariant{1007});
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MultipleBlocks) {
+  // epoch-like values with a narrow range per block
+  const auto row_count = 3 * FrameOfReferenceSegment<int64_t>::BLOCK_SIZE + 17;
+  for (auto index = int64_t{0}; index < row_count; ++index) vc_long->append(int64_t{1500000000000} + index * 3);
+  auto segment = FrameOfReferenceSegment<int64_t>(vc_long);
+
+  EXPECT_EQ(segment.block_minima()->size(), 4u);
+  EXPECT_EQ((*segment.block_minima())[1], int64_t{1500000000000} + 3 * FrameOfReferenceSegment<int64_t>::BLOCK_SIZE);
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    ASSERT_EQ(segment.get(index), int64_t{1500000000000} + index * 3);
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, NegativeAndExtremeValues) {
+  for (auto value : {-5, std::numeric_limits<int32_t>::min() + 10, -1, std::numeric_limits<int32_t>::min()}) {
+    vc_int->append(value);
+  }
+  auto segment = FrameOfReferenceSegment<int32_t>(vc_int);
+
+  EXPECT_EQ(segment.get(0), -5);
+  EXPECT_EQ(segment.get(1), std::numeric_limits<int32_t>::min() + 10);
+  EXPECT_EQ(segment.get(2), -1);
+  EXPECT_EQ(segment.get(3), std::numeric_limits<int32_t>::min());
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, FullRange) {
+  // the range of any 32 bit values fits into the offsets
+  vc_int->append(std::numeric_limits<int32_t>::max());
+  vc_int->append(std::numeric_limits<int32_t>::min());
+  EXPECT_TRUE(FrameOfReferenceSegment<int32_t>::is_encodable(vc_int));
+  auto segment = FrameOfReferenceSegment<int32_t>(vc_int);
+
+  EXPECT_EQ(segment.max_offset(), std::numeric_limits<uint32_t>::max());
+  EXPECT_EQ(segment.get(0), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(segment.get(1), std::numeric_limits<int32_t>::min());
+
+  vc_long->append(int64_t{0});
+  vc_long->append(int64_t{std::numeric_limits<uint32_t>::max()});
+  EXPECT_TRUE(FrameOfReferenceSegment<int64_t>::is_encodable(vc_long));
+  EXPECT_EQ(FrameOfReferenceSegment<int64_t>{vc_long}.get(1), int64_t{std::numeric_limits<uint32_t>::max()});
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, RangeTooLarge) {
+  vc_long->append(int64_t{0});
+  vc_long->append(int64_t{std::numeric_limits<uint32_t>::max()} + 1);
+
+  EXPECT_FALSE(FrameOfReferenceSegment<int64_t>::is_encodable(vc_long));
+  EXPECT_THROW(FrameOfReferenceSegment<int64_t>{vc_long}, std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Append) {
+  auto segment = FrameOfReferenceSegment<int32_t>(vc_int);
+
+  EXPECT_THROW(segment.append(4), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressChunk) {
+  auto table = Table{2};
+  table.add_column("a", "long");
+  table.add_column("b", "float");
+  table.append({int64_t{17}, 1.0f});
+  table.append({int64_t{4}, 2.0f});
+
+  // floating point columns cannot be frame-of-reference encoded
+  EXPECT_THROW(table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference), std::logic_error);
+
+  auto int_table = Table{2};
+  int_table.add_column("a", "int");
+  int_table.append({17});
+  int_table.append({4});
+  int_table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  const auto segment = int_table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(segment), nullptr);
+
+  // chunks whose values are too far apart are dictionary encoded instead
+  auto long_table = Table{2};
+  long_table.add_column("a", "long");
+  long_table.append({std::numeric_limits<int64_t>::min()});
+  long_table.append({std::numeric_limits<int64_t>::max()});
+  long_table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  const auto long_segment = long_table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_EQ(long_segment->segment_type(), SegmentType::Dictionary);
+  EXPECT_EQ((*long_segment)[1], AllTypeVariant{std::numeric_limits<int64_t>::max()});
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, TableScan) {
+  const auto chunk_size = 2 * FrameOfReferenceSegment<int32_t>::BLOCK_SIZE + 100;
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", "int");
+  for (auto index = int32_t{0}; index < 2 * static_cast<int32_t>(chunk_size); ++index) table->append({index * 2});
+  table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  table->compress_chunk(ChunkID{1}, EncodingType::FrameOfReference);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // 5000 is the 2501st value
+  auto expected_row_counts = std::vector<std::pair<ScanType, size_t>>{};
+  expected_row_counts.emplace_back(ScanType::OpEquals, 1);
+  expected_row_counts.emplace_back(ScanType::OpNotEquals, 2 * chunk_size - 1);
+  expected_row_counts.emplace_back(ScanType::OpLessThan, 2500);
+  expected_row_counts.emplace_back(ScanType::OpLessThanEquals, 2501);
+  expected_row_counts.emplace_back(ScanType::OpGreaterThan, 2 * chunk_size - 2501);
+  expected_row_counts.emplace_back(ScanType::OpGreaterThanEquals, 2 * chunk_size - 2500);
+  for (const auto& [scan_type, row_count] : expected_row_counts) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, 5000);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), row_count);
+
+    // the same scan on ReferenceSegments pointing to the FrameOfReferenceSegments
+    auto all_rows = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, -1);
+    all_rows->execute();
+    auto scan_on_references = std::make_shared<TableScan>(all_rows, ColumnID{0}, scan_type, 5000);
+    scan_on_references->execute();
+    EXPECT_EQ(scan_on_references->get_output()->row_count(), row_count);
+  }
+
+  // search values outside of the value range of all blocks
+  auto scan_below = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, -10);
+  scan_below->execute();
+  EXPECT_EQ(scan_below->get_output()->row_count(), 0u);
+
+  auto scan_above = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 1000000);
+  scan_above->execute();
+  EXPECT_EQ(scan_above->get_output()->row_count(), 2 * chunk_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/front_coded_dictionary.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 50 sorted urls sharing long prefixes, spanning several blocks
+    for (auto index = 0; index < 50; ++index) {
+      auto number = std::to_string(index);
+      number.insert(0, 3 - number.size(), '0');
+      values.push_back("https://example.com/users/" + number + "/profile");
+    }
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageFrontCodedDictionaryTest, RandomAccess) {
+  const auto dictionary = FrontCodedDictionary{values.cbegin(), values.cend()};
+
+  EXPECT_EQ(dictionary.size(), values.size());
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary[index], values[index]);
+  }
+  EXPECT_EQ(dictionary.at(FrontCodedDictionary::BLOCK_SIZE), values[FrontCodedDictionary::BLOCK_SIZE]);
+  EXPECT_THROW(dictionary.at(values.size()), std::logic_error);
+
+  // the shared prefixes are stored only once per block
+  auto raw_size = size_t{0};
+  for (const auto& value : values) raw_size += value.size();
+  EXPECT_LT(dictionary.data_size(), raw_size / 2);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, EmptyAndLongStrings) {
+  const auto long_value = std::string(1000, 'x');
+  const auto sorted_values = std::vector<std::string>{"", "a", "ab", long_value, long_value + "y"};
+  const auto dictionary = FrontCodedDictionary{sorted_values.cbegin(), sorted_values.cend()};
+
+  for (auto index = size_t{0}; index < sorted_values.size(); ++index) {
+    EXPECT_EQ(dictionary[index], sorted_values[index]);
+  }
+  EXPECT_EQ(dictionary.lower_bound(""), 0u);
+  EXPECT_EQ(dictionary.upper_bound(""), 1u);
+  EXPECT_EQ(dictionary.lower_bound(long_value), 3u);
+
+  const auto empty_values = std::vector<std::string>{};
+  const auto empty_dictionary = FrontCodedDictionary{empty_values.cbegin(), empty_values.cend()};
+  EXPECT_EQ(empty_dictionary.size(), 0u);
+  EXPECT_EQ(empty_dictionary.lower_bound("a"), 0u);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, LowerUpperBound) {
+  const auto dictionary = FrontCodedDictionary{values.cbegin(), values.cend()};
+
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary.lower_bound(values[index]), index);
+    EXPECT_EQ(dictionary.upper_bound(values[index]), index + 1);
+
+    // a string that is sorted directly after values[index]
+    EXPECT_EQ(dictionary.lower_bound(values[index] + "a"), index + 1);
+    EXPECT_EQ(dictionary.upper_bound(values[index] + "a"), index + 1);
+  }
+
+  EXPECT_EQ(dictionary.lower_bound("a"), 0u);
+  EXPECT_EQ(dictionary.upper_bound("a"), 0u);
+  EXPECT_EQ(dictionary.lower_bound("z"), values.size());
+  EXPECT_EQ(dictionary.upper_bound("z"), values.size());
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, DictionarySegment) {
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto index = values.size(); index > 0; --index) value_segment->append(values[index - 1]);
+  value_segment->append(values[0]);
+
+  const auto segment = DictionarySegment<std::string>{value_segment};
+  EXPECT_EQ(segment.unique_values_count(), values.size());
+  EXPECT_EQ(segment.get(0), values.back());
+  EXPECT_EQ(segment.get(values.size()), values.front());
+  EXPECT_EQ(segment.lower_bound(values[20]), ValueID{20});
+  EXPECT_EQ(segment.upper_bound(values[20]), ValueID{21});
+  EXPECT_EQ(segment.lower_bound(std::string{"z"}), INVALID_VALUE_ID);
+  EXPECT_EQ(segment.upper_bound(values.back()), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, TableScan) {
+  auto table = std::make_shared<Table>(values.size());
+  table->add_column("url", "string");
+  for (const auto& value : values) table->append({value});
+  table->compress_chunk(ChunkID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_equals = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, values[33]);
+  scan_equals->execute();
+  EXPECT_EQ(scan_equals->get_output()->row_count(), 1u);
+
+  auto scan_less = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, values[33]);
+  scan_less->execute();
+  EXPECT_EQ(scan_less->get_output()->row_count(), 33u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/group_key_index.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("string");
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "inbox", "hotel", "frank"}) {
+      value_segment->append(value);
+    }
+    _segment = make_shared_by_data_type<BaseSegment, DictionarySegment>("string", value_segment);
+    _index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseSegment>>{_segment});
+  }
+
+  // returns the positions in [begin, end)
+  static std::vector<ChunkOffset> _positions(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<BaseSegment> _segment;
+  std::shared_ptr<GroupKeyIndex> _index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, Postings) {
+  // ordered by value, positions of equal values in ascending order
+  EXPECT_EQ(_positions(_index->cbegin(), _index->cend()), std::vector<ChunkOffset>({4, 5, 1, 3, 2, 8, 0, 7, 6}));
+  EXPECT_EQ(_index->type(), SegmentIndexType::GroupKey);
+}
+
+TEST_F(StorageGroupKeyIndexTest, Bounds) {
+  EXPECT_EQ(_positions(_index->lower_bound({"delta"}), _index->upper_bound({"delta"})),
+            std::vector<ChunkOffset>({1, 3}));
+  EXPECT_EQ(_positions(_index->cbegin(), _index->lower_bound({"frank"})), std::vector<ChunkOffset>({4, 5, 1, 3}));
+  EXPECT_EQ(_positions(_index->upper_bound({"frank"}), _index->cend()), std::vector<ChunkOffset>({0, 7, 6}));
+
+  // values that are not in the dictionary
+  EXPECT_EQ(_index->lower_bound({"echo"}), _index->upper_bound({"echo"}));
+  EXPECT_EQ(_index->lower_bound({"echo"}), _index->lower_bound({"frank"}));
+  EXPECT_EQ(_index->lower_bound({"aaa"}), _index->cbegin());
+  EXPECT_EQ(_index->lower_bound({"zulu"}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({"inbox"}), _index->cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, IndexedSegments) {
+  EXPECT_TRUE(_index->is_index_for({_segment}));
+  EXPECT_FALSE(_index->is_index_for({}));
+
+  const auto value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("string");
+  EXPECT_FALSE(_index->is_index_for({value_segment}));
+  EXPECT_THROW(GroupKeyIndex({value_segment}), std::logic_error);
+}
+
+TEST_F(StorageGroupKeyIndexTest, ChunkIndexes) {
+  auto chunk = Chunk{};
+  chunk.add_segment(_segment);
+  EXPECT_EQ(chunk.get_index(SegmentIndexType::GroupKey, {ColumnID{0}}), nullptr);
+
+  const auto index = chunk.create_index<GroupKeyIndex>({ColumnID{0}});
+  EXPECT_EQ(chunk.get_index(SegmentIndexType::GroupKey, {ColumnID{0}}), index);
+  EXPECT_EQ(chunk.get_indexes({ColumnID{0}}).size(), 1u);
+  EXPECT_GT(chunk.estimate_memory_usage(), chunk.estimate_memory_usage(ColumnID{0}) + index->estimate_memory_usage());
+
+  // an index does not apply to the segment that replaces its segment
+  chunk.replace_segment(ColumnID{0}, make_shared_by_data_type<BaseSegment, DictionarySegment>("string", _segment));
+  EXPECT_EQ(chunk.get_index(SegmentIndexType::GroupKey, {ColumnID{0}}), nullptr);
+}
+
+}  // namespace opossum
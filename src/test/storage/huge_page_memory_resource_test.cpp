@@ -0,0 +1,62 @@
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/huge_page_memory_resource.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageHugePageMemoryResourceTest : public BaseTest {
+ protected:
+  HugePageMemoryResource memory_resource{};
+};
+
+TEST_F(StorageHugePageMemoryResourceTest, SmallAllocationsUseUpstream) {
+  auto data = memory_resource.allocate(1024, 8);
+  EXPECT_EQ(memory_resource.huge_page_allocation_count() + memory_resource.fallback_allocation_count(), 0u);
+  std::memset(data, 1, 1024);
+  memory_resource.deallocate(data, 1024, 8);
+}
+
+TEST_F(StorageHugePageMemoryResourceTest, LargeAllocations) {
+  // with or without reserved huge pages, the memory is aligned to a huge page and can be used
+  const auto size = 3 * HugePageMemoryResource::HUGE_PAGE_SIZE + 5;
+  auto data = memory_resource.allocate(size, 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % HugePageMemoryResource::HUGE_PAGE_SIZE, 0u);
+  EXPECT_EQ(memory_resource.huge_page_allocation_count() + memory_resource.fallback_allocation_count(), 1u);
+  std::memset(data, 1, size);
+  EXPECT_EQ(static_cast<char*>(data)[size - 1], 1);
+  memory_resource.deallocate(data, size, 64);
+}
+
+TEST_F(StorageHugePageMemoryResourceTest, Equality) {
+  auto other_memory_resource = HugePageMemoryResource{};
+  EXPECT_TRUE(memory_resource.is_equal(memory_resource));
+  EXPECT_FALSE(memory_resource.is_equal(other_memory_resource));
+  EXPECT_EQ(huge_page_memory_resource(), huge_page_memory_resource());
+}
+
+TEST_F(StorageHugePageMemoryResourceTest, Table) {
+  // a small threshold, so that the segments of the table are backed by huge pages
+  auto small_memory_resource = HugePageMemoryResource{4096};
+  auto table = Table{1000, &small_memory_resource};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  for (auto value = 0; value < 2500; ++value) table.append({value, std::to_string(value % 10)});
+  EXPECT_GT(small_memory_resource.huge_page_allocation_count() + small_memory_resource.fallback_allocation_count(), 0u);
+
+  table.compress_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})),
+            nullptr);
+  EXPECT_EQ((*table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[999], AllTypeVariant{999});
+  EXPECT_EQ((*table.get_chunk(ChunkID{2}).get_segment(ColumnID{1}))[499], AllTypeVariant{"9"});
+}
+
+}  // namespace opossum
@@ -94,4 +94,11 @@ TEST_F(ReferenceSegmentTest, RetrievesValuesFromChunks) {
   EXPECT_EQ(reference_segment[2], column_2[1]);
 }
 
+TEST_F(ReferenceSegmentTest, EstimateMemoryUsage) {
+  auto pos_list = std::make_shared<PosList>(100, RowID{ChunkID{0}, 0});
+  auto reference_segment = ReferenceSegment(_test_table, ColumnID{0}, pos_list);
+
+  EXPECT_GE(reference_segment.estimate_memory_usage(), 100 * sizeof(RowID));
+}
+
 }  // namespace opossum
@@ -0,0 +1,81 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  vc_str->append("Bill");
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Alexander");
+  vc_str->append("Alexander");
+  vc_str->append("Bill");
+
+  auto col = make_shared_by_data_type<BaseSegment, RunLengthSegment>("string", vc_str);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthSegment<std::string>>(col);
+
+  EXPECT_EQ(rle_col->size(), 7u);
+  EXPECT_EQ(rle_col->run_count(), 4u);
+  EXPECT_EQ(*rle_col->values(), std::vector<std::string>({"Bill", "Steve", "Alexander", "Bill"}));
+  EXPECT_EQ(*rle_col->end_positions(), std::vector<ChunkOffset>({1, 2, 5, 6}));
+  EXPECT_EQ(rle_col->zone_map()->min, AllTypeVariant{"Alexander"});
+  EXPECT_EQ(rle_col->zone_map()->max, AllTypeVariant{"Steve"});
+}
+
+TEST_F(StorageRunLengthSegmentTest, Get) {
+  for (auto value : {3, 3, 3, 1, 2, 2}) vc_int->append(value);
+  auto col = make_shared_by_data_type<BaseSegment, RunLengthSegment>("int", vc_int);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthSegment<int>>(col);
+
+  EXPECT_EQ(rle_col->get(0), 3);
+  EXPECT_EQ(rle_col->get(2), 3);
+  EXPECT_EQ(rle_col->get(3), 1);
+  EXPECT_EQ(rle_col->get(4), 2);
+  EXPECT_EQ(rle_col->get(5), 2);
+  EXPECT_EQ((*rle_col)[3], AllTypeVariant{1});
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  auto col = make_shared_by_data_type<BaseSegment, RunLengthSegment>("int", vc_int);
+
+  EXPECT_EQ(col->size(), 0u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Append) {
+  auto col = make_shared_by_data_type<BaseSegment, RunLengthSegment>("int", vc_int);
+
+  EXPECT_THROW(col->append(4), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressChunk) {
+  auto table = Table{4};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  for (auto value : {1, 1, 1, 2, 2}) table.append({value, "value"});
+
+  table.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  const auto segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  const auto rle_segment = std::dynamic_pointer_cast<RunLengthSegment<int>>(segment);
+  ASSERT_NE(rle_segment, nullptr);
+  EXPECT_EQ(rle_segment->run_count(), 2u);
+  EXPECT_EQ(rle_segment->size(), 4u);
+}
+
+}  // namespace opossum
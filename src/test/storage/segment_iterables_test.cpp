@@ -0,0 +1,88 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_iterables.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/types.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterablesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // more than one frame of a FrameOfReferenceSegment and one block of a DeltaSegment
+    _table = std::make_shared<Table>(2500);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto row = 0; row < 5000; ++row) {
+      _table->append({_int_value(row), std::to_string(_int_value(row))});
+    }
+  }
+
+  static int32_t _int_value(const int row) { return row / 3 - 500; }
+
+  // checks that for_each and get yield the values of the segment
+  template <typename T>
+  void _expect_values(const BaseSegment& segment) const {
+    with_segment_iterable<T>(segment, [&](const auto& iterable) {
+      auto expected_chunk_offset = ChunkOffset{0};
+      iterable.for_each([&](const auto& position) {
+        EXPECT_EQ(position.chunk_offset, expected_chunk_offset);
+        EXPECT_EQ(T{position.value}, type_cast<T>(segment[position.chunk_offset]));
+        ++expected_chunk_offset;
+      });
+      EXPECT_EQ(expected_chunk_offset, segment.size());
+      EXPECT_EQ(T{iterable.get(ChunkOffset{1234})}, type_cast<T>(segment[1234]));
+    });
+  }
+
+  std::shared_ptr<BaseSegment> _segment(const ColumnID column_id) const {
+    return _table->get_chunk(ChunkID{0}).get_segment(column_id);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageSegmentIterablesTest, ValueSegment) {
+  _expect_values<int32_t>(*_segment(ColumnID{0}));
+  _expect_values<std::string>(*_segment(ColumnID{1}));
+}
+
+TEST_F(StorageSegmentIterablesTest, EncodedSegments) {
+  _expect_values<int32_t>(DictionarySegment<int32_t>{_segment(ColumnID{0})});
+  _expect_values<std::string>(DictionarySegment<std::string>{_segment(ColumnID{1})});
+  _expect_values<int32_t>(RunLengthSegment<int32_t>{_segment(ColumnID{0})});
+  _expect_values<std::string>(RunLengthSegment<std::string>{_segment(ColumnID{1})});
+  _expect_values<int32_t>(FrameOfReferenceSegment<int32_t>{_segment(ColumnID{0})});
+  _expect_values<int32_t>(DeltaSegment<int32_t>{_segment(ColumnID{0})});
+}
+
+TEST_F(StorageSegmentIterablesTest, ReferenceSegment) {
+  _table->compress_chunk(ChunkID{1});
+  const auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{1}, ChunkOffset{10}},
+                                                          {ChunkID{1}, ChunkOffset{2}},
+                                                          {ChunkID{0}, ChunkOffset{7}},
+                                                          {ChunkID{1}, ChunkOffset{2499}}});
+  const auto reference_segment = ReferenceSegment{_table, ColumnID{0}, pos_list};
+
+  auto values = std::vector<int32_t>();
+  with_segment_iterable<int32_t>(reference_segment, [&](const auto& iterable) {
+    iterable.for_each([&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset, values.size());
+      values.push_back(position.value);
+    });
+    EXPECT_EQ(iterable.get(ChunkOffset{2}), _int_value(7));
+  });
+  EXPECT_EQ(values, std::vector<int32_t>({_int_value(2510), _int_value(2502), _int_value(7), _int_value(4999)}));
+}
+
+TEST_F(StorageSegmentIterablesTest, TypeMismatch) {
+  EXPECT_THROW(with_segment_iterable<std::string>(*_segment(ColumnID{0}), [](const auto&) {}), std::logic_error);
+}
+
+}  // namespace opossum
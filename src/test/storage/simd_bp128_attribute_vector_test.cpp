@@ -0,0 +1,83 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/simd_bp128_attribute_vector.hpp"
+
+namespace opossum {
+
+class StorageSimdBp128AttributeVectorTest : public ::testing::Test {
+ protected:
+  // fills a vector with (index * 7) % (max_value + 1), so that neighbouring value ids differ in many bits
+  static SimdBp128AttributeVector make_filled_vector(const size_t size, const uint32_t max_value) {
+    auto vec = SimdBp128AttributeVector(size, ValueID{max_value});
+    for (size_t index = 0; index < size; ++index) {
+      vec.set(index, ValueID{static_cast<uint32_t>((index * 7) % (uint64_t{max_value} + 1))});
+    }
+    return vec;
+  }
+};
+
+TEST_F(StorageSimdBp128AttributeVectorTest, GetSet) {
+  auto vec = SimdBp128AttributeVector(5, ValueID(50));
+  vec.set(0, ValueID(4));
+  vec.set(3, ValueID(50));
+
+  EXPECT_EQ(vec.get(0), 4u);
+  EXPECT_EQ(vec.get(1), 0u);
+  EXPECT_EQ(vec.get(3), 50u);
+
+  EXPECT_THROW(vec.set(1, ValueID(64)), std::logic_error);
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, SizeAndWidth) {
+  const auto vec = SimdBp128AttributeVector(300, ValueID(100000));
+
+  EXPECT_EQ(vec.size(), 300u);
+  EXPECT_EQ(vec.bits_per_value(), 17u);
+  EXPECT_EQ(vec.width(), 3u);
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, GetAllBitWidths) {
+  for (auto bits = uint32_t{1}; bits <= 32; ++bits) {
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bits) - 1);
+    const auto vec = make_filled_vector(300, max_value);
+    ASSERT_EQ(vec.bits_per_value(), bits);
+
+    for (size_t index = 0; index < vec.size(); ++index) {
+      ASSERT_EQ(vec.get(index), ValueID{static_cast<uint32_t>((index * 7) % (uint64_t{max_value} + 1))})
+          << "bits: " << bits << ", index: " << index;
+    }
+  }
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, DecodeBlockAllBitWidths) {
+  for (auto bits = uint32_t{1}; bits <= 32; ++bits) {
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bits) - 1);
+    const auto vec = make_filled_vector(300, max_value);
+
+    auto decoded = ValueIDBlock{};
+    for (size_t offset = 0; offset < vec.size(); offset += ATTRIBUTE_VECTOR_BLOCK_SIZE) {
+      const auto count = vec.decode_block(offset, decoded);
+      ASSERT_EQ(count, std::min(ATTRIBUTE_VECTOR_BLOCK_SIZE, vec.size() - offset));
+
+      for (size_t index = 0; index < count; ++index) {
+        ASSERT_EQ(decoded[index], vec.get(offset + index)) << "bits: " << bits << ", index: " << offset + index;
+      }
+    }
+  }
+}
+
+TEST_F(StorageSimdBp128AttributeVectorTest, DecodeUnalignedBlock) {
+  const auto vec = make_filled_vector(300, 1000);
+
+  auto decoded = ValueIDBlock{};
+  EXPECT_EQ(vec.decode_block(250, decoded), 50u);
+  for (size_t index = 0; index < 50; ++index) {
+    EXPECT_EQ(decoded[index], vec.get(250 + index));
+  }
+}
+
+}  // namespace opossum
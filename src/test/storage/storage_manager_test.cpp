@@ -1,5 +1,10 @@
+#include <atomic>
+#include <filesystem>
 #include <memory>
+#include <memory_resource>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -10,6 +15,26 @@
 
 namespace opossum {
 
+// counts the allocations that are made through it
+class AllocationCountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  size_t allocation_count() const { return _allocation_count; }
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++_allocation_count;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  std::atomic<size_t> _allocation_count{0};
+};
+
 class StorageStorageManagerTest : public BaseTest {
  protected:
   void SetUp() override {
@@ -57,4 +82,161 @@ TEST_F(StorageStorageManagerTest, TableNames) {
   EXPECT_EQ(sm.table_names(), std::vector<std::string>({"first_table", "second_table"}));
 }
 
+TEST_F(StorageStorageManagerTest, Print) {
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  table->add_column("col_1", "int");
+  for (auto value = 0; value < 4; ++value) table->append({value});
+
+  auto output = std::ostringstream{};
+  sm.print(output);
+  EXPECT_NE(output.str().find("memory_usage"), std::string::npos);
+  EXPECT_NE(output.str().find("compression_ratio"), std::string::npos);
+  EXPECT_NE(output.str().find(std::to_string(table->estimate_memory_usage())), std::string::npos);
+}
+
+TEST_F(StorageStorageManagerTest, SnapshotRestoresTablesLazily) {
+  const auto directory = std::string{"storage_manager_test_snapshot"};
+  std::filesystem::remove_all(directory);
+
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  table->add_column("col_1", "int");
+  table->add_column("col_2", "string");
+  for (auto value = 0; value < 10; ++value) table->append({value, std::to_string(value)});
+  table->compress_chunk(ChunkID{0});
+  sm.save_snapshot(directory);
+
+  sm.reset();
+  sm.restore_snapshot(directory);
+  EXPECT_EQ(sm.table_names(), std::vector<std::string>({"first_table", "second_table"}));
+  EXPECT_TRUE(sm.has_table("second_table"));
+  EXPECT_FALSE(sm.is_table_loaded("second_table"));
+
+  const auto restored_table = sm.get_table("second_table");
+  EXPECT_TRUE(sm.is_table_loaded("second_table"));
+  EXPECT_FALSE(sm.is_table_loaded("first_table"));
+  EXPECT_EQ(sm.get_table("second_table"), restored_table);
+  EXPECT_TABLE_EQ(restored_table, table, true);
+
+  // restoring the same tables again would overwrite them
+  EXPECT_THROW(sm.restore_snapshot(directory), std::logic_error);
+
+  sm.drop_table("first_table");
+  EXPECT_FALSE(sm.has_table("first_table"));
+  EXPECT_THROW(sm.restore_snapshot(directory + "_missing"), std::logic_error);
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, ConcurrentlyLoadRestoredTable) {
+  const auto directory = std::string{"storage_manager_test_concurrent_snapshot"};
+  std::filesystem::remove_all(directory);
+
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("first_table");
+  table->add_column("col_1", "int");
+  for (auto value = 0; value < 100'000; ++value) table->append({value});
+  sm.save_snapshot(directory);
+
+  // all threads that ask for the table while it is being loaded get the same one
+  for (auto iteration = 0; iteration < 20; ++iteration) {
+    sm.reset();
+    sm.restore_snapshot(directory);
+
+    auto tables = std::vector<std::shared_ptr<Table>>(8);
+    auto is_started = std::atomic_bool{false};
+    auto threads = std::vector<std::thread>();
+    for (auto& loaded_table : tables) {
+      threads.emplace_back([&]() {
+        while (!is_started) std::this_thread::yield();
+        loaded_table = sm.get_table("first_table");
+      });
+    }
+    is_started = true;
+    for (auto& thread : threads) thread.join();
+
+    for (const auto& loaded_table : tables) {
+      ASSERT_NE(loaded_table, nullptr);
+      EXPECT_EQ(loaded_table, tables.front());
+    }
+    EXPECT_EQ(tables.front()->row_count(), 100'000u);
+  }
+
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, LoadRestoredTableOnce) {
+  const auto directory = std::string{"storage_manager_test_load_once_snapshot"};
+  std::filesystem::remove_all(directory);
+
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("first_table");
+  table->add_column("col_1", "int");
+  for (auto value = 0; value < 100'000; ++value) table->append({value});
+  sm.save_snapshot(directory);
+
+  // the tables are loaded from the default memory resource, so the number of allocations tells how often it was loaded
+  auto memory_resource = AllocationCountingMemoryResource{};
+  auto* const previous_memory_resource = std::pmr::set_default_resource(&memory_resource);
+
+  sm.reset();
+  sm.restore_snapshot(directory);
+  sm.get_table("first_table");
+  const auto allocations_per_load = memory_resource.allocation_count();
+  EXPECT_GT(allocations_per_load, 0u);
+
+  for (auto iteration = 0; iteration < 20; ++iteration) {
+    sm.reset();
+    sm.restore_snapshot(directory);
+    const auto previous_allocation_count = memory_resource.allocation_count();
+
+    auto is_started = std::atomic_bool{false};
+    auto threads = std::vector<std::thread>();
+    for (auto thread_index = 0; thread_index < 8; ++thread_index) {
+      threads.emplace_back([&]() {
+        while (!is_started) std::this_thread::yield();
+        sm.get_table("first_table");
+      });
+    }
+    is_started = true;
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(memory_resource.allocation_count() - previous_allocation_count, allocations_per_load);
+  }
+
+  sm.reset();
+  std::pmr::set_default_resource(previous_memory_resource);
+  std::filesystem::remove_all(directory);
+}
+
+TEST_F(StorageStorageManagerTest, SnapshotCopiesUnloadedTables) {
+  const auto directory = std::string{"storage_manager_test_copy_snapshot"};
+  const auto copy_directory = directory + "_copy";
+  std::filesystem::remove_all(directory);
+  std::filesystem::remove_all(copy_directory);
+
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  table->add_column("col_1", "int");
+  for (auto value = 0; value < 10; ++value) table->append({value});
+  sm.save_snapshot(directory);
+
+  sm.reset();
+  sm.restore_snapshot(directory);
+  sm.save_snapshot(copy_directory);
+  EXPECT_FALSE(sm.is_table_loaded("second_table"));
+
+  // saving into the directory that the tables were restored from keeps their files
+  sm.save_snapshot(directory);
+  EXPECT_FALSE(sm.is_table_loaded("second_table"));
+  EXPECT_TABLE_EQ(sm.get_table("second_table"), table);
+
+  sm.reset();
+  sm.restore_snapshot(copy_directory);
+  EXPECT_TABLE_EQ(sm.get_table("second_table"), table);
+
+  std::filesystem::remove_all(directory);
+  std::filesystem::remove_all(copy_directory);
+}
+
 }  // namespace opossum
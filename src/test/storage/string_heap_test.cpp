@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/string_heap.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageStringHeapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto& value : values) string_heap.push_back(value);
+  }
+
+  const std::vector<std::string> values{"Bill", "", std::string(100, 'x'), "Steve", "Alexander"};
+  StringHeap string_heap;
+};
+
+TEST_F(StorageStringHeapTest, RandomAccess) {
+  EXPECT_EQ(string_heap.size(), values.size());
+  EXPECT_FALSE(string_heap.empty());
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(string_heap[index], values[index]);
+  }
+  EXPECT_EQ(string_heap.at(4), "Alexander");
+  EXPECT_THROW(string_heap.at(5), std::logic_error);
+  EXPECT_EQ(string_heap.data_size(), 118u);
+  EXPECT_TRUE(StringHeap{}.empty());
+}
+
+TEST_F(StorageStringHeapTest, Iterators) {
+  EXPECT_EQ(string_heap.cend() - string_heap.cbegin(), 5);
+  EXPECT_TRUE(std::equal(string_heap.cbegin(), string_heap.cend(), values.cbegin(), values.cend()));
+
+  const auto [min_it, max_it] = std::minmax_element(string_heap.cbegin(), string_heap.cend());
+  EXPECT_EQ(*min_it, "");
+  EXPECT_EQ(*max_it, std::string(100, 'x'));
+
+  auto it = string_heap.cbegin() + 3;
+  EXPECT_EQ(*it, "Steve");
+  EXPECT_EQ(*--it, values[2]);
+  EXPECT_EQ(it[2], "Alexander");
+}
+
+TEST_F(StorageStringHeapTest, Reserve) {
+  auto reserved_heap = StringHeap{};
+  reserved_heap.reserve(10, 1000);
+  const auto memory_usage = reserved_heap.estimate_memory_usage();
+  EXPECT_GE(memory_usage, 1000 + 10 * sizeof(size_t));
+
+  // appending within the reserved capacity does not allocate
+  for (const auto& value : values) reserved_heap.push_back(value);
+  EXPECT_EQ(reserved_heap.estimate_memory_usage(), memory_usage);
+}
+
+TEST_F(StorageStringHeapTest, TableScan) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("name", "string");
+  for (const auto& value : values) table->append({value});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_equals = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, "Steve");
+  scan_equals->execute();
+  EXPECT_EQ(scan_equals->get_output()->row_count(), 1u);
+
+  auto scan_less = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, "Bill");
+  scan_less->execute();
+  EXPECT_EQ(scan_less->get_output()->row_count(), 2u);
+
+  // scanning the output scans the referenced string heap
+  auto scan_referenced = std::make_shared<TableScan>(scan_less, ColumnID{0}, ScanType::OpNotEquals, "");
+  scan_referenced->execute();
+  EXPECT_EQ(scan_referenced->get_output()->row_count(), 1u);
+}
+
+}  // namespace opossum
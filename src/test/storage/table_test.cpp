@@ -1,6 +1,10 @@
+#include <atomic>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,11 +12,33 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
 #include "../lib/storage/table.hpp"
 #include "../lib/storage/value_segment.hpp"
 
 namespace opossum {
 
+// counts the bytes that are currently allocated through it
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  size_t allocated_bytes() const { return _allocated_bytes; }
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    _allocated_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+    _allocated_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  std::atomic<size_t> _allocated_bytes{0};
+};
+
 class StorageTableTest : public BaseTest {
  protected:
   void SetUp() override {
@@ -94,4 +120,255 @@ TEST_F(StorageTableTest, EmplaceChunk) {
     EXPECT_EQ(t.chunk_count(), 2u);
   }
 }
+
+TEST_F(StorageTableTest, CompressChunk) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.compress_chunk(ChunkID{0});
+
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})), nullptr);
+  EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[0], AllTypeVariant{"Hello,"});
+
+  // the last chunk is not full yet
+  EXPECT_THROW(t.compress_chunk(ChunkID{1}), std::logic_error);
+}
+
+TEST_F(StorageTableTest, SetSortedBy) {
+  t.append({1, "c"});
+  t.append({2, "b"});
+  t.append({2, "a"});
+  t.set_sorted_by(ColumnID{0}, SortMode::Ascending);
+  t.set_sorted_by(ColumnID{1}, SortMode::Descending);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).sorted_by(ColumnID{0}), SortMode::Ascending);
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).sorted_by(ColumnID{1}), SortMode::Descending);
+
+  // the values of the first chunk are not in descending order
+  EXPECT_THROW(t.set_sorted_by(ColumnID{0}, SortMode::Descending), std::logic_error);
+
+  // appending clears the flags of the chunk that is appended to
+  t.append({0, "z"});
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).sorted_by(ColumnID{0}), std::nullopt);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).sorted_by(ColumnID{0}), SortMode::Ascending);
+}
+
+TEST_F(StorageTableTest, SortChunk) {
+  t.append({3, "three"});
+  t.append({1, "one"});
+  t.append({2, "two"});
+  t.get_chunk(ChunkID{0}).set_sorted_by(ColumnID{1}, SortMode::Descending);
+  t.sort_chunk(ChunkID{0}, ColumnID{0});
+
+  // the rows are moved together, and the other columns are not sorted anymore
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[0], AllTypeVariant{1});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[0], AllTypeVariant{"one"});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[1], AllTypeVariant{"three"});
+  EXPECT_EQ(chunk.sorted_by(ColumnID{0}), SortMode::Ascending);
+  EXPECT_EQ(chunk.sorted_by(ColumnID{1}), std::nullopt);
+
+  t.sort_chunk(ChunkID{0}, ColumnID{1}, SortMode::Descending);
+  EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[0], AllTypeVariant{3});
+  EXPECT_EQ((*chunk.get_segment(ColumnID{1}))[0], AllTypeVariant{"three"});
+  EXPECT_EQ(chunk.sorted_by(ColumnID{1}), SortMode::Descending);
+
+  // the last chunk is not full yet, and compressed chunks cannot be sorted
+  EXPECT_THROW(t.sort_chunk(ChunkID{1}, ColumnID{0}), std::logic_error);
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ(chunk.sorted_by(ColumnID{1}), SortMode::Descending);
+  EXPECT_THROW(t.sort_chunk(ChunkID{0}, ColumnID{0}), std::logic_error);
+}
+
+TEST_F(StorageTableTest, SharedDictionary) {
+  t.enable_shared_dictionary(ColumnID{1});
+  t.append({4, "b"});
+  t.append({6, "d"});
+  t.append({3, "b"});
+  t.append({5, "d"});
+  t.append({7, "a"});
+  t.append({8, "c"});
+  t.append({9, "a"});
+  t.compress_chunk(ChunkID{0});
+  t.compress_chunk(ChunkID{1});
+
+  const auto segment_0 = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+  const auto segment_1 = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      t.get_chunk(ChunkID{1}).get_segment(ColumnID{1}));
+  ASSERT_NE(segment_0, nullptr);
+  ASSERT_NE(segment_1, nullptr);
+  EXPECT_EQ(segment_0->dictionary(), segment_1->dictionary());
+  EXPECT_EQ(segment_0->unique_values_count(), 2u);
+  EXPECT_EQ(segment_0->get(1), "d");
+  EXPECT_EQ(segment_0->zone_map()->max, AllTypeVariant{"d"});
+
+  // chunk 2 adds new values, so the dictionary is rebuilt and the earlier chunks are re-encoded
+  t.compress_chunk(ChunkID{2});
+  const auto segment_2 = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      t.get_chunk(ChunkID{2}).get_segment(ColumnID{1}));
+  ASSERT_NE(segment_2, nullptr);
+  EXPECT_EQ(segment_2->unique_values_count(), 4u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+        t.get_chunk(chunk_id).get_segment(ColumnID{1}));
+    EXPECT_EQ(segment->dictionary(), segment_2->dictionary());
+  }
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))[0], AllTypeVariant{"b"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[1], AllTypeVariant{"d"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{2}).get_segment(ColumnID{1}))[1], AllTypeVariant{"c"});
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).zone_map(ColumnID{1})->min, AllTypeVariant{"b"});
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).zone_map(ColumnID{1})->min, AllTypeVariant{"a"});
+
+  // value ids are comparable across chunks
+  EXPECT_EQ(segment_2->lower_bound(std::string{"b"}), ValueID{1});
+
+  // the column without a shared dictionary keeps one dictionary per segment
+  const auto int_segment_0 = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  const auto int_segment_1 = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      t.get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
+  EXPECT_NE(int_segment_0->dictionary(), int_segment_1->dictionary());
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  t.append({1, "a"});
+  t.append_columns(std::vector<int32_t>{2, 3, 4, 5}, std::vector<std::string>{"b", "c", "d", "e"});
+
+  // the rows fill up the first chunk and are split across the following ones
+  EXPECT_EQ(t.row_count(), 5u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{0}).get_segment(ColumnID{0}))[1], AllTypeVariant{2});
+  EXPECT_EQ((*t.get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[1], AllTypeVariant{"d"});
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).size(), 1u);
+
+  t.append_columns(std::vector<int32_t>{}, std::vector<std::string>{});
+  EXPECT_EQ(t.row_count(), 5u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsMismatch) {
+  EXPECT_THROW(t.append_columns(std::vector<int32_t>{1}), std::logic_error);
+  EXPECT_THROW(t.append_columns(std::vector<int64_t>{1}, std::vector<std::string>{"a"}), std::logic_error);
+  EXPECT_THROW(t.append_columns(std::vector<int32_t>{1, 2}, std::vector<std::string>{"a"}), std::logic_error);
+  EXPECT_EQ(t.row_count(), 0u);
+}
+
+TEST_F(StorageTableTest, CompressChunksWithSharedDictionary) {
+  t.enable_shared_dictionary(ColumnID{1});
+  for (auto value = 0; value < 8; ++value) t.append({value, std::to_string(7 - value)});
+  t.compress_chunk(ChunkID{0});
+  const auto first_dictionary = t.shared_dictionary(ColumnID{1});
+
+  // the values of all chunks are added to the dictionary at once, so it is only replaced once
+  t.compress_chunks({ChunkID{1}, ChunkID{2}, ChunkID{3}});
+  EXPECT_NE(t.shared_dictionary(ColumnID{1}), first_dictionary);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+        t.get_chunk(chunk_id).get_segment(ColumnID{1}));
+    ASSERT_NE(segment, nullptr);
+    EXPECT_EQ(segment->dictionary(), t.shared_dictionary(ColumnID{1}));
+    EXPECT_EQ(segment->unique_values_count(), 8u);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 2; ++chunk_offset) {
+      EXPECT_EQ(segment->get(chunk_offset), std::to_string(7 - (chunk_id * 2 + chunk_offset)));
+    }
+  }
+  EXPECT_EQ(std::dynamic_pointer_cast<DictionarySegment<std::string>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}))
+                ->attribute_vector()
+                ->get(0),
+            ValueID{7});
+  EXPECT_THROW(t.compress_chunks({ChunkID{3}, ChunkID{4}}), std::logic_error);
+}
+
+TEST_F(StorageTableTest, AutoCompression) {
+  t.enable_auto_compression();
+  EXPECT_THROW(t.enable_auto_compression(), std::logic_error);
+
+  for (auto i = 0; i < 101; ++i) t.append({i, std::to_string(i)});
+  t.wait_for_auto_compression();
+
+  // all chunks but the last one are full and have been compressed
+  EXPECT_EQ(t.chunk_count(), 51u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 50; ++chunk_id) {
+    const auto& chunk = t.get_chunk(chunk_id);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk.get_segment(ColumnID{0})), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk.get_segment(ColumnID{1})), nullptr);
+    EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[1], AllTypeVariant{static_cast<int32_t>(chunk_id * 2 + 1)});
+  }
+  const auto& last_chunk = t.get_chunk(ChunkID{50});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(last_chunk.get_segment(ColumnID{0})), nullptr);
+}
+
+TEST_F(StorageTableTest, AutoCompressionFailure) {
+  auto table = Table{2};
+  table.add_column("a", "float");
+  table.enable_auto_compression(EncodingType::FrameOfReference);
+
+  for (auto i = 0; i < 3; ++i) table.append({static_cast<float>(i)});
+
+  // floats cannot be frame-of-reference encoded, the chunk stays uncompressed
+  EXPECT_THROW(table.wait_for_auto_compression(), std::logic_error);
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<float>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0})),
+            nullptr);
+  EXPECT_NO_THROW(table.wait_for_auto_compression());
+}
+
+TEST_F(StorageTableTest, ConcurrentReadDuringCompression) {
+  auto table = Table{1000};
+  table.add_column("a", "int");
+  for (auto i = 0; i < 1000; ++i) table.append({i});
+  table.append({1000});
+
+  // a reader keeps accessing the full chunk while it is being compressed
+  auto reader = std::thread([&]() {
+    for (auto iteration = 0; iteration < 100; ++iteration) {
+      const auto segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+      ASSERT_EQ((*segment)[999], AllTypeVariant{999});
+    }
+  });
+  table.compress_chunk(ChunkID{0});
+  reader.join();
+
+  const auto segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(segment), nullptr);
+}
+
+TEST_F(StorageTableTest, EstimateMemoryUsage) {
+  auto table = Table{1000};
+  table.add_column("col_1", "int");
+  table.add_column("col_2", "string");
+  table.append_columns(std::vector<int32_t>(1000, 7), std::vector<std::string>(1000, "a string of some length"));
+
+  const auto int_memory_usage = table.estimate_memory_usage(ColumnID{0});
+  const auto string_memory_usage = table.estimate_memory_usage(ColumnID{1});
+  EXPECT_GE(int_memory_usage, 1000 * sizeof(int32_t));
+  EXPECT_GE(string_memory_usage, 1000 * std::string{"a string of some length"}.size());
+  EXPECT_GE(table.estimate_memory_usage(), int_memory_usage + string_memory_usage);
+
+  // the attribute vectors of the compressed segments need one byte per value, and each dictionary holds one value
+  table.compress_chunk(ChunkID{0});
+  EXPECT_LT(table.estimate_memory_usage(ColumnID{0}), int_memory_usage / 3);
+  EXPECT_LT(table.estimate_memory_usage(ColumnID{1}), string_memory_usage / 20);
+}
+
+TEST_F(StorageTableTest, MemoryResource) {
+  auto memory_resource = CountingMemoryResource{};
+  {
+    auto table = Table{100, &memory_resource};
+    EXPECT_EQ(table.memory_resource(), &memory_resource);
+    table.add_column("col_1", "int");
+    table.add_column("col_2", "string");
+    table.append_columns(std::vector<int32_t>(150, 7), std::vector<std::string>(150, "a string of some length"));
+    EXPECT_GE(memory_resource.allocated_bytes(), 150 * (sizeof(int32_t) + 23));
+
+    // the compressed segments are allocated from the same resource, while the replaced ones are freed
+    const auto uncompressed_bytes = memory_resource.allocated_bytes();
+    table.compress_chunk(ChunkID{0});
+    EXPECT_GT(memory_resource.allocated_bytes(), 0u);
+    EXPECT_LT(memory_resource.allocated_bytes(), uncompressed_bytes);
+  }
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+}
+
 }  // namespace opossum
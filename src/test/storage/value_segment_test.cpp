@@ -51,7 +51,50 @@ TEST_F(StorageValueSegmentTest, GetValues) {
   int_value_segment.append(4);
   int_value_segment.append(2);
 
-  EXPECT_EQ(int_value_segment.values(), std::vector<int>({4, 2}));
+  EXPECT_EQ(int_value_segment.values(), pmr_vector<int>({4, 2}));
+}
+
+TEST_F(StorageValueSegmentTest, ZoneMap) {
+  EXPECT_FALSE(int_value_segment.zone_map());
+
+  int_value_segment.append(4);
+  int_value_segment.append(2);
+  int_value_segment.append(3);
+  EXPECT_EQ(int_value_segment.zone_map()->min, AllTypeVariant{2});
+  EXPECT_EQ(int_value_segment.zone_map()->max, AllTypeVariant{4});
+
+  auto values = std::vector<int>{9, 1, 5};
+  int_value_segment.append_values(std::move(values), 1, 2);
+  EXPECT_EQ(int_value_segment.zone_map()->min, AllTypeVariant{1});
+  EXPECT_EQ(int_value_segment.zone_map()->max, AllTypeVariant{5});
+}
+
+TEST_F(StorageValueSegmentTest, AppendValues) {
+  auto values = std::vector<int>{1, 2, 3};
+  int_value_segment.append_values(std::move(values), 0, 3);
+  auto more_values = std::vector<int>{4, 5, 6};
+  int_value_segment.append_values(std::move(more_values), 1, 2);
+  EXPECT_EQ(int_value_segment.values(), pmr_vector<int>({1, 2, 3, 5, 6}));
+
+  // strings are copied into the string heap
+  auto string_values = std::vector<std::string>{"a", "b", "c"};
+  string_value_segment.append_values(std::move(string_values), 1, 2);
+  string_value_segment.append("d");
+  const auto& heap = string_value_segment.values();
+  EXPECT_EQ(std::vector<std::string>(heap.cbegin(), heap.cend()), std::vector<std::string>({"b", "c", "d"}));
+  EXPECT_EQ(string_value_segment[2], AllTypeVariant{"d"});
+}
+
+TEST_F(StorageValueSegmentTest, EstimateMemoryUsage) {
+  const auto empty_memory_usage = int_value_segment.estimate_memory_usage();
+  EXPECT_GE(empty_memory_usage, sizeof(ValueSegment<int>));
+
+  int_value_segment.append_values(std::vector<int>(100, 1), 0, 100);
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), empty_memory_usage + 100 * sizeof(int));
+
+  // the characters of long strings are stored outside of the string objects
+  string_value_segment.append(std::string(1000, 'x'));
+  EXPECT_GE(string_value_segment.estimate_memory_usage(), sizeof(ValueSegment<std::string>) + 1000);
 }
 
 }  // namespace opossum
@@ -0,0 +1,194 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/binary_table.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class BinaryTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    for (auto index = 0; index < 8; ++index) {
+      _table->append({index % 3, int64_t{index} << 40, index * 0.5f, index * 0.25, std::string(index * 5, 'x')});
+    }
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  // segments are loaded in their encoded form, so they use as much memory as the original ones
+  static void _expect_same_encodings(const Table& loaded_table, const Table& table) {
+    ASSERT_EQ(loaded_table.chunk_count(), table.chunk_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+        const auto& segment = *table.get_chunk(chunk_id).get_segment(column_id);
+        const auto& loaded_segment = *loaded_table.get_chunk(chunk_id).get_segment(column_id);
+        EXPECT_EQ(loaded_segment.segment_type(), segment.segment_type());
+        EXPECT_EQ(loaded_segment.estimate_memory_usage(), segment.estimate_memory_usage());
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::string _file_name = "binary_table_test.bin";
+};
+
+TEST_F(BinaryTableTest, WriteAndLoadValueSegments) {
+  write_binary_table(*_table, _file_name);
+  const auto loaded_table = load_binary_table(_file_name);
+
+  EXPECT_EQ(loaded_table->chunk_size(), 3u);
+  EXPECT_EQ(loaded_table->chunk_count(), 3u);
+  EXPECT_EQ(loaded_table->column_names(), _table->column_names());
+  EXPECT_EQ(loaded_table->column_type(ColumnID{4}), "string");
+  EXPECT_TABLE_EQ(loaded_table, _table);
+
+  const auto string_segment = loaded_table->get_chunk(ChunkID{2}).get_segment(ColumnID{4});
+  ASSERT_NE(std::dynamic_pointer_cast<ValueSegment<std::string>>(string_segment), nullptr);
+  EXPECT_EQ(string_segment->zone_map()->max, AllTypeVariant{std::string(35, 'x')});
+
+  // the last chunk is not full, so appending continues there
+  loaded_table->append({1, int64_t{1}, 1.0f, 1.0, "y"});
+  EXPECT_EQ(loaded_table->chunk_count(), 3u);
+  EXPECT_EQ(loaded_table->row_count(), 9u);
+}
+
+TEST_F(BinaryTableTest, WriteAndLoadCompressedSegments) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  _table->set_sorted_by(ColumnID{4}, SortMode::Ascending);
+  write_binary_table(*_table, _file_name);
+  const auto loaded_table = load_binary_table(_file_name);
+
+  EXPECT_TABLE_EQ(loaded_table, _table);
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{1}).sorted_by(ColumnID{4}), SortMode::Ascending);
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{1}).sorted_by(ColumnID{0}), std::nullopt);
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      loaded_table->get_chunk(ChunkID{0}).get_segment(ColumnID{4}));
+  ASSERT_NE(dictionary_segment, nullptr);
+  EXPECT_EQ(dictionary_segment->unique_values_count(), 3u);
+  EXPECT_EQ(dictionary_segment->attribute_vector()->width(), 1u);
+  EXPECT_EQ(dictionary_segment->zone_map()->max, AllTypeVariant{std::string(10, 'x')});
+
+  _expect_same_encodings(*loaded_table, *_table);
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{1}).get_segment(ColumnID{4})->zone_map()->min,
+            AllTypeVariant{std::string(15, 'x')});
+}
+
+TEST_F(BinaryTableTest, WriteAndLoadIntegralEncodings) {
+  // large enough for SIMD-BP128 attribute vectors and multiple frame-of-reference blocks
+  auto table = Table{5000};
+  table.add_column("a", "int");
+  table.add_column("b", "long");
+  for (auto index = 0; index < 15'000; ++index) table.append({index % 300, int64_t{index} * 3 - (index % 7)});
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1}, EncodingType::FrameOfReference);
+  table.compress_chunk(ChunkID{2}, EncodingType::Delta);
+  write_binary_table(table, _file_name);
+  const auto loaded_table = load_binary_table(_file_name);
+
+  EXPECT_TABLE_EQ(*loaded_table, table);
+  _expect_same_encodings(*loaded_table, table);
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{1}).zone_map(ColumnID{1})->max, AllTypeVariant{int64_t{29'994}});
+}
+
+TEST_F(BinaryTableTest, WriteAndLoadSharedDictionaries) {
+  auto table = Table{3};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.add_column("c", "int");
+  table.enable_shared_dictionary(ColumnID{1});
+  table.enable_shared_dictionary(ColumnID{2});
+  for (auto index = 0; index < 8; ++index) table.append({index, std::string(index % 4, 'x'), index});
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1});
+  write_binary_table(table, _file_name);
+  auto loaded_table = load_binary_table(_file_name);
+
+  EXPECT_TABLE_EQ(*loaded_table, table);
+  _expect_same_encodings(*loaded_table, table);
+  EXPECT_FALSE(loaded_table->has_shared_dictionary(ColumnID{0}));
+  EXPECT_TRUE(loaded_table->has_shared_dictionary(ColumnID{1}));
+  EXPECT_TRUE(loaded_table->has_shared_dictionary(ColumnID{2}));
+
+  // the segments refer to the one dictionary of the column again
+  const auto shared_dictionary = loaded_table->shared_dictionary(ColumnID{1});
+  ASSERT_NE(shared_dictionary, nullptr);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+        loaded_table->get_chunk(chunk_id).get_segment(ColumnID{1}));
+    ASSERT_NE(segment, nullptr);
+    EXPECT_EQ(segment->dictionary(), shared_dictionary);
+  }
+
+  // new chunks are still compressed with the shared dictionary
+  loaded_table->append({8, std::string(5, 'x'), 8});
+  loaded_table->compress_chunk(ChunkID{2});
+  const auto segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      loaded_table->get_chunk(ChunkID{2}).get_segment(ColumnID{2}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->dictionary(), loaded_table->shared_dictionary(ColumnID{2}));
+  EXPECT_EQ(segment->unique_values_count(), 9u);
+  EXPECT_EQ((*loaded_table->get_chunk(ChunkID{1}).get_segment(ColumnID{1}))[0], AllTypeVariant{std::string(3, 'x')});
+}
+
+TEST_F(BinaryTableTest, EmptyTable) {
+  auto table = Table{10};
+  table.add_column("a", "int");
+  write_binary_table(table, _file_name);
+
+  const auto loaded_table = load_binary_table(_file_name);
+  EXPECT_EQ(loaded_table->row_count(), 0u);
+  EXPECT_EQ(loaded_table->chunk_count(), 1u);
+  EXPECT_EQ(loaded_table->column_count(), 1u);
+}
+
+TEST_F(BinaryTableTest, LoadedTableDoesNotDependOnFile) {
+  _table->compress_chunk(ChunkID{0});
+  write_binary_table(*_table, _file_name);
+  const auto loaded_table = load_binary_table(_file_name);
+
+  // the segments own their memory, so overwriting the file does not change them
+  auto table = Table{10};
+  table.add_column("a", "int");
+  write_binary_table(table, _file_name);
+  EXPECT_TABLE_EQ(loaded_table, _table);
+}
+
+TEST_F(BinaryTableTest, InvalidFiles) {
+  EXPECT_THROW(load_binary_table("does_not_exist.bin"), std::logic_error);
+
+  // a .tbl file is not a binary table
+  EXPECT_THROW(load_binary_table("src/test/tables/int_float.tbl"), std::logic_error);
+
+  // a truncated file
+  write_binary_table(*_table, _file_name);
+  auto contents = std::string{};
+  {
+    auto file = std::ifstream{_file_name, std::ios::binary};
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  {
+    auto file = std::ofstream{_file_name, std::ios::binary | std::ios::trunc};
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size() / 2));
+  }
+  EXPECT_THROW(load_binary_table(_file_name), std::logic_error);
+}
+
+}  // namespace opossum
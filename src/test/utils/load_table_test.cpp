@@ -0,0 +1,105 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/load_table.hpp"
+
+namespace opossum {
+
+class LoadTableTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  void _write_file(const std::string& contents) {
+    auto file = std::ofstream{_file_name, std::ios::binary | std::ios::trunc};
+    file << contents;
+  }
+
+  const std::string _file_name = "load_table_test.tbl";
+};
+
+TEST_F(LoadTableTest, LoadTable) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+
+  auto expected_table = std::make_shared<Table>(2);
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "float");
+  expected_table->append({12345, 458.7f});
+  expected_table->append({123, 456.7f});
+  expected_table->append({1234, 457.7f});
+
+  EXPECT_TABLE_EQ(table, expected_table, true);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1}).size(), 1u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).zone_map(ColumnID{0})->min, AllTypeVariant{123});
+}
+
+TEST_F(LoadTableTest, AllDataTypes) {
+  _write_file("a|b|c|d|e\r\nint|long|float|double|string\r\n-1|5000000000|0.5|-0.25|hello world\r\n\r\n2|3|4|5|\r\n");
+  const auto table = load_table(_file_name, 10);
+
+  auto expected_table = std::make_shared<Table>(10);
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "long");
+  expected_table->add_column("c", "float");
+  expected_table->add_column("d", "double");
+  expected_table->add_column("e", "string");
+  expected_table->append({-1, int64_t{5'000'000'000}, 0.5f, -0.25, "hello world"});
+  expected_table->append({2, int64_t{3}, 4.0f, 5.0, ""});
+
+  EXPECT_TABLE_EQ(table, expected_table, true);
+}
+
+TEST_F(LoadTableTest, ManyChunks) {
+  auto contents = std::string{"a|b\nint|string\n"};
+  for (auto index = 0; index < 1000; ++index) {
+    contents += std::to_string(index) + "|" + std::to_string(index % 7) + "\n";
+  }
+  _write_file(contents);
+
+  const auto table = load_table(_file_name, 64, EncodingType::Dictionary);
+  EXPECT_EQ(table->chunk_count(), 16u);
+  EXPECT_EQ(table->row_count(), 1000u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[5], AllTypeVariant{static_cast<int32_t>(chunk_id * 64 + 5)});
+  }
+
+  // all full chunks are compressed, the last one is not
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+                table->get_chunk(ChunkID{14}).get_segment(ColumnID{1})),
+            nullptr);
+  EXPECT_NE(
+      std::dynamic_pointer_cast<ValueSegment<std::string>>(table->get_chunk(ChunkID{15}).get_segment(ColumnID{1})),
+      nullptr);
+}
+
+TEST_F(LoadTableTest, HeaderOnly) {
+  _write_file("a|b\nint|string\n");
+  const auto table = load_table(_file_name, 10);
+  EXPECT_EQ(table->column_count(), 2u);
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->chunk_count(), 1u);
+}
+
+TEST_F(LoadTableTest, InvalidFiles) {
+  EXPECT_THROW(load_table("does_not_exist.tbl", 10), std::logic_error);
+
+  _write_file("a|b\nint|float\n1|x\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a|b\nint|float\n1\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a|b\nint|float\n1|2|3\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+}
+
+}  // namespace opossum